@@ -0,0 +1,168 @@
+#ifndef APT_APT_DECODER_H_
+#define APT_APT_DECODER_H_
+
+#include <filter/filter.h>
+#include <filter/analytic_signal.h>
+#include <filter/envelope_detector.h>
+#include <filter/decimator.h>
+#include <types.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+/**
+ * \defgroup group_apt APT
+ * \brief Decoding of the Automatic Picture Transmission (APT) images sent by the NOAA weather satellites.
+ *
+ * An APT signal is a 2400Hz subcarrier, amplitude modulated by 4160 words per second. Two lines of 2080 words
+ * are sent per second. Every line starts with the sync A pattern, followed by the image of channel A, and has
+ * the sync B pattern in the middle, followed by the image of channel B.
+ */
+
+
+/**\ingroup group_apt
+ * \brief The kind of signal stored in the file passed to \ref DecodeAptWave().
+ */
+enum AptSource {
+	APT_AUDIO,	///< The first channel contains the FM demodulated audio with the 2400Hz subcarrier.
+	APT_IQ		///< The first two channels contain the IQ samples of the FM modulated satellite signal.
+};
+
+
+/**\ingroup group_apt
+ * \brief Decodes the lines of an APT image from the audio signal provided by a filter.
+ *
+ * The decoder is driven like a filter at the end of a chain: Its input is set with \ref SetInput() and
+ * every call to \ref Update() consumes one block of the input. Internally, the envelope of the subcarrier
+ * is calculated by an \ref AnalyticSignal and an \ref EnvelopeDetector, decimated and resampled to
+ * 4160 words per second. The start of every line is found by correlating the words with the sync A and
+ * sync B patterns. Once a line is found, only a few words around the expected start of the next line are searched.
+ */
+class AptDecoder
+{
+public:
+	static constexpr uint32_t WordRate = 4160;		///< The number of words per second of an APT signal
+	static constexpr uint32_t LineLength = 2080;	///< The number of words per line
+
+
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second of the audio signal.
+	 */
+	AptDecoder(double sample_rate);
+
+
+	/**
+	 * \brief Set the filter providing the audio signal.
+	 * \param in A `std::pair` with the following contents:
+	 *               - __in.first__:  A pointer to the filter providing a \ref Real output.
+	 *               - __in.second__: The index of the filter's output to use as an input.
+	 */
+	void SetInput(const std::pair<const Filter*, size_t>& in);
+
+	/**
+	 * \brief Consume one block of the input and decode all lines that became complete.
+	 */
+	void Update();
+
+
+	/**
+	 * \brief Get the number of decoded lines.
+	 * \returns The number of lines decoded so far.
+	 */
+	size_t LineCount() const;
+
+	/**
+	 * \brief Get the decoded words.
+	 * \returns The words of all decoded lines. Line `i` starts at `Lines()[i * LineLength]` with the sync A pattern.
+	 */
+	const std::vector<Real>& Lines() const;
+
+	/**
+	 * \brief Get the decoded lines as a grayscale image.
+	 *
+	 * The words are mapped linearly to 8 bits, clipping the darkest and brightest 0.5% of the words.
+	 *
+	 * \returns The pixels of an image with \ref LineLength columns and \ref LineCount() rows.
+	 */
+	std::vector<uint8_t> Image() const;
+
+	/**
+	 * \brief Write the image returned by \ref Image() to a binary PGM file.
+	 * \param path The path of the file to write.
+	 * \throws std::runtime_error If the file can't be opened.
+	 */
+	void WritePgm(const std::string& path) const;
+
+private:
+	AnalyticSignal<Real> analytic;		///< Removes the negative frequencies of the subcarrier
+	EnvelopeDetector<Complex> envelope;	///< Calculates the envelope of the subcarrier
+	Decimator<Real> decimator;			///< Reduces the sample rate of the envelope to at least twice the word rate
+
+	const double resample_step;			///< The number of decimated samples per word
+	double resample_position = 0;		///< The position of the next word relative to the first sample of the current block
+	Real last_sample = 0;				///< The last sample of the previous decimated block
+
+	std::vector<Real> words;			///< The resampled words which are not yet part of a line
+	size_t search_begin = 0;			///< The index in \ref words at which the search for the next line starts
+
+	std::vector<Real> sync_a;			///< The zero mean sync A pattern
+	std::vector<Real> sync_b;			///< The zero mean sync B pattern
+	bool locked = false;				///< Wether the position of the next line is known
+	Real mean_peak = 0;					///< The running average of the correlation peaks of the decoded lines
+
+	std::vector<Real> lines;			///< The words of all decoded lines
+
+	/**
+	 * \brief Resample the current block of the decimator to words.
+	 */
+	void Resample();
+
+	/**
+	 * \brief Cut all complete lines from \ref words.
+	 */
+	void ExtractLines();
+
+	/**
+	 * \brief Find the line start with the best correlation to the sync patterns.
+	 * \param begin The first position to test.
+	 * \param count The number of positions to test.
+	 * \returns A pair of the position of the best correlation and the correlation itself.
+	 */
+	std::pair<size_t, Real> FindSync(size_t begin, size_t count) const;
+};
+
+
+/**\ingroup group_apt
+ * \brief Decode the APT image stored in a WAVE file.
+ *
+ * The signal is read with a \ref RiffWaveInput. IQ recordings are first decimated to about 40kHz
+ * by a \ref Decimator and demodulated by a \ref FmDemodulator.
+ *
+ * \param path The path of the WAVE file.
+ * \param source The kind of signal stored in the file.
+ * \returns The decoder containing the decoded lines.
+ * \throws std::runtime_error If the file can't be opened.
+ * \throws std::invalid_argument If the file is no valid WAVE file or has samples that can't be read.
+ */
+std::unique_ptr<AptDecoder> DecodeAptWave(const std::string& path, AptSource source);
+
+
+//---------- inlined / templated functions implementation ----------//
+
+inline size_t AptDecoder::LineCount() const
+{
+	return lines.size() / LineLength;
+}
+
+
+inline const std::vector<Real>& AptDecoder::Lines() const
+{
+	return lines;
+}
+
+
+#endif //APT_APT_DECODER_H_
\ No newline at end of file
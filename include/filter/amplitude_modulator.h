@@ -24,8 +24,9 @@ public:
 	 * \param amplitude The maximal amplitude of the carrier wave assuming the input's amplitude
 	 *                  never leaves the range [-1, 1]. This defaults to 1.
 	 * \param phaseshift The phase shift of the carrier wave in the interval `[0, 2pi)`.
+	 * \param mode The way the carrier wave is calculated. This defaults to \ref NCO_SINCOSPI.
 	 */
-	AmplitudeModulator(double sample_rate, Real frequency = Real(1), Real amplitude = Real(1), Real phaseshift = Real(0));
+	AmplitudeModulator(double sample_rate, Real frequency = Real(1), Real amplitude = Real(1), Real phaseshift = Real(0), NcoMode mode = NCO_SINCOSPI);
 
 
 	/**
@@ -54,8 +55,7 @@ template<>
 inline void AmplitudeModulator<Real>::CalculateOutput()
 {
 	RealSimd ampl = RealSimd(amplitude) * boost::simd::aligned_load<RealSimd, const Real*>(GetRealInput(0));
-	auto result = boost::simd::cospi(phase_div_pi);
-	boost::simd::aligned_store(ampl * result, real());
+	boost::simd::aligned_store(ampl * nco.Cos(), real());
 }
 ///\endcond
 
@@ -65,7 +65,7 @@ template<>
 inline void AmplitudeModulator<Complex>::CalculateOutput()
 {
 	RealSimd ampl = RealSimd(amplitude) * boost::simd::aligned_load<RealSimd, const Real*>(GetRealInput(0));
-	auto result = boost::simd::sincospi(phase_div_pi);
+	auto result = nco.SinCos();
 	boost::simd::aligned_store(ampl * result.second, real());
 	boost::simd::aligned_store(ampl * result.first, imag());
 }
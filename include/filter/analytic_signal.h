@@ -0,0 +1,75 @@
+#ifndef FILTER_ANALYTIC_SIGNAL_H_
+#define FILTER_ANALYTIC_SIGNAL_H_
+
+#include <filter/filter.h>
+#include <filter/sample_history.h>
+#include <filter/window_functions.h>
+#include <types.h>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+
+/**\ingroup group_filters
+ * \brief Convert a real signal to its analytic signal.
+ *
+ * The imaginary part of the \ref Complex output is the Hilbert transform of the input, calculated with
+ * a windowed FIR approximation of the ideal Hilbert transformer. The real part is the input delayed by the
+ * same number of samples as the Hilbert transformer, so the output only contains the positive frequencies
+ * of the input. Every other coefficient of the Hilbert transformer is zero and the remaining ones are
+ * antisymmetric, so only a quarter of the taps need a multiplication.
+ *
+ * \tparam Tin The type of input this filter accepts. Has to be \ref Real.
+ */
+template<typename Tin>
+class AnalyticSignal : public Filter
+{
+	static_assert(std::is_same<Tin, Real>::value, "AnalyticSignal needs a Real input signal!");
+
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param tapcount The number of taps of the Hilbert transformer. Has to be odd. This defaults to 63.
+	 * \param window_function The window function to weigh the coefficients with. This defaults to \ref Hamming.
+	 */
+	AnalyticSignal(double sample_rate, uint32_t tapcount = 63, const std::function<Real(Real)>& window_function = Hamming);
+
+
+	/**
+	 * \brief Update the output of this filter.
+	 */
+	virtual void Update();
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 * \returns The delay of the Hilbert transformer, which is `(tapcount-1)/2` samples.
+	 */
+	virtual double GroupDelay() const;
+
+private:
+	const uint32_t half_length;	///< The number of taps on each side of the center tap
+
+	/**
+	 * \brief The nonzero coefficients of the Hilbert transformer with a positive offset from the center tap.
+	 *
+	 * Element `i` is the coefficient `2i+1` taps after the center. The coefficient `2i+1` taps before the
+	 * center has the same magnitude and the opposite sign.
+	 */
+	std::vector<Real> coefficients;
+
+	SampleHistory history;	///< The input samples needed to calculate the current block
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline double AnalyticSignal<Tin>::GroupDelay() const
+{
+	return half_length * DeltatimeIn();
+}
+
+
+#endif //FILTER_ANALYTIC_SIGNAL_H_
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef FILTER_BATCH_BIQUAD_CASCADE_H_
+#define FILTER_BATCH_BIQUAD_CASCADE_H_
+
+#include <filter/batch_filter.h>
+#include <filter/biquad_cascade.h>
+#include <types.h>
+#include <vector>
+
+
+/**\ingroup group_filters
+ * \brief A cascade of second order IIR sections run on many independent channels.
+ *
+ * Every channel is filtered like by its own \ref BiquadCascade with the same sections. The recursion is evaluated
+ * sample by sample in transposed direct form II, but every SIMD instruction advances \ref RealSimd::static_size
+ * channels, so no block state space matrices are needed.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class BatchBiquadCascade : public BatchFilter<Tin>
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the inputs of this filter.
+	 * \param channel_count The number of independent channels.
+	 * \param sections The sections of the filter, e.g. designed with \ref BiquadSection::ButterworthLowPass.
+	 */
+	BatchBiquadCascade(double sample_rate, size_t channel_count, const std::vector<BiquadSection>& sections);
+
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 *
+	 * The frequency at which the group delay is evaluated is chosen by \ref BiquadSection::GroupDelay.
+	 *
+	 * \returns The group delay of this filter in seconds.
+	 */
+	virtual double GroupDelay() const;
+
+
+	/**
+	 * \brief Get the sections of this filter.
+	 * \returns The sections of this filter.
+	 */
+	const std::vector<BiquadSection>& Sections() const;
+
+protected:
+	virtual void ProcessGroup(size_t group, Real* lanes_real, Real* lanes_imag);
+
+private:
+	const std::vector<BiquadSection> sections;	///< The coefficients of the sections
+
+	/**
+	 * \brief The state variables of all groups.
+	 *
+	 * Every group stores the two channel interleaved state variables of every section, first for the real
+	 * and then for the imaginary part of the signal.
+	 */
+	AlignedStdVec<Real> state;
+
+
+	/**
+	 * \brief Filter a channel interleaved block through all sections.
+	 * \param lanes The block to filter in place.
+	 * \param state The state variables of all sections.
+	 */
+	void Process(Real* lanes, Real* state) const;
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline const std::vector<BiquadSection>& BatchBiquadCascade<Tin>::Sections() const
+{
+	return sections;
+}
+
+
+#endif //FILTER_BATCH_BIQUAD_CASCADE_H_
@@ -0,0 +1,72 @@
+#ifndef FILTER_BATCH_DIFFERENTIATOR_H_
+#define FILTER_BATCH_DIFFERENTIATOR_H_
+
+#include <filter/batch_filter.h>
+#include <types.h>
+
+
+/**\ingroup group_filters
+ * \brief Differentiate many independent channels.
+ *
+ * Every channel is differentiated like by its own \ref Differentiator. The backward difference of a sample
+ * only needs the previous row of the channel interleaved block, so every difference is calculated for
+ * \ref RealSimd::static_size channels at once.
+ *
+ * \tparam Tin The type of input signal to this filter. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class BatchDifferentiator : public BatchFilter<Tin>
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the inputs of this filter.
+	 * \param channel_count The number of independent channels.
+	 */
+	BatchDifferentiator(double sample_rate, size_t channel_count);
+
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 * \returns The group delay of the backward difference, which is half a sample.
+	 */
+	virtual double GroupDelay() const;
+
+protected:
+	virtual void ProcessGroup(size_t group, Real* lanes_real, Real* lanes_imag);
+
+private:
+	/**
+	 * \brief The factor needed to output the correct derivative of the input signal.
+	 *
+	 * See \ref Differentiator for details.
+	 */
+	const Real amplitude_correction_factor;
+
+	/**
+	 * \brief The last samples of all channels.
+	 *
+	 * Every group stores one row for the real and one row for the imaginary part of the signal.
+	 */
+	AlignedStdVec<Real> last_samples;
+
+
+	/**
+	 * \brief Differentiate a channel interleaved block.
+	 * \param lanes The block to differentiate in place.
+	 * \param last The last samples of the channels of the group.
+	 */
+	void Process(Real* lanes, Real* last) const;
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline double BatchDifferentiator<Tin>::GroupDelay() const
+{
+	return this->DeltatimeIn() / 2;
+}
+
+
+#endif //FILTER_BATCH_DIFFERENTIATOR_H_
@@ -0,0 +1,89 @@
+#ifndef FILTER_BATCH_FILTER_H_
+#define FILTER_BATCH_FILTER_H_
+
+#include <filter/filter.h>
+#include <types.h>
+#include <cstddef>
+
+
+/**
+ * \brief The base of the filters processing many independent channels at once.
+ *
+ * Filters like \ref BiquadCascade are recursive, or like a short \ref Fir have too little work per sample,
+ * so they can't fill a SIMD register with consecutive samples of one signal. A batched filter runs the same
+ * filter on \ref ChannelCount() independent signals instead and puts one channel into every element of a
+ * register. Channel `c` is read from input `c` and written to output `c`.
+ *
+ * Every update transposes the blocks of a group of \ref RealSimd::static_size channels into channel interleaved
+ * lanes, where `lanes[t * RealSimd::static_size + k]` is sample `t` of channel `k` of the group. The derived filter
+ * advances all channels of the group by one sample with every SIMD instruction in \ref ProcessGroup(), and the
+ * lanes are transposed back into the outputs. The unused lanes of the last group are 0.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class BatchFilter : public Filter
+{
+public:
+	/**
+	 * \brief Update the outputs of this filter.
+	 */
+	virtual void Update();
+
+
+	/**
+	 * \brief Get the number of channels.
+	 * \returns The number of inputs and outputs of this filter.
+	 */
+	size_t ChannelCount() const;
+
+	/**
+	 * \brief Get the number of groups.
+	 * \returns The number of groups of \ref RealSimd::static_size channels processed together.
+	 */
+	size_t GroupCount() const;
+
+protected:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the inputs of this filter.
+	 * \param channel_count The number of independent channels.
+	 * \param output_type The type of all outputs.
+	 */
+	BatchFilter(double sample_rate, size_t channel_count, Filter::FilterOutputType output_type);
+
+
+	/**
+	 * \brief Filter one block of a group of channels in place.
+	 * \param group The index of the group, e.g. to find its state.
+	 * \param lanes_real The real part of the channel interleaved block. Has to be replaced by the output.
+	 * \param lanes_imag The imaginary part of the channel interleaved block. It is 0 for \ref Real inputs, so a filter with
+	 *                   \ref Complex outputs can fill it, and it is ignored for \ref Real outputs.
+	 */
+	virtual void ProcessGroup(size_t group, Real* lanes_real, Real* lanes_imag) = 0;
+
+private:
+	const size_t channel_count;					///< The number of independent channels
+	const Filter::FilterOutputType output_type;	///< The type of all outputs
+	AlignedStdVec<Real> lanes_real;				///< The real part of the block of the current group
+	AlignedStdVec<Real> lanes_imag;				///< The imaginary part of the block of the current group
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline size_t BatchFilter<Tin>::ChannelCount() const
+{
+	return channel_count;
+}
+
+
+template<typename Tin>
+inline size_t BatchFilter<Tin>::GroupCount() const
+{
+	return (channel_count + RealSimd::static_size - 1) / RealSimd::static_size;
+}
+
+
+#endif //FILTER_BATCH_FILTER_H_
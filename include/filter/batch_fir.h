@@ -0,0 +1,106 @@
+#ifndef FILTER_BATCH_FIR_H_
+#define FILTER_BATCH_FIR_H_
+
+#include <filter/batch_filter.h>
+#include <types.h>
+#include <vector>
+
+
+/**\ingroup group_filters
+ * \brief A Finite Impulse Response filter run on many independent channels.
+ *
+ * Every channel is filtered like by its own \ref Fir with the same coefficients. Every tap is one SIMD
+ * multiply-add for \ref RealSimd::static_size channels, so even filters with a few taps use the whole register.
+ * A \ref LowPass is run on many channels by passing the coefficients of \ref LowPassCoefficients.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class BatchFir : public BatchFilter<Tin>
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the inputs of this filter.
+	 * \param channel_count The number of independent channels.
+	 * \param coeff A `std::vector<Real>` of filter coefficients.
+	 */
+	BatchFir(double sample_rate, size_t channel_count, const std::vector<Real>& coeff);
+
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 * \returns The group delay of the coefficients in seconds, see \ref FirGroupDelay.
+	 */
+	virtual double GroupDelay() const;
+
+
+	/**
+	 * \brief Get the coefficients of this filter.
+	 * \returns The coefficients of this filter.
+	 */
+	const std::vector<Real>& Coefficients() const;
+
+protected:
+	virtual void ProcessGroup(size_t group, Real* lanes_real, Real* lanes_imag);
+
+private:
+	const std::vector<Real> coeff;	///< The filter coefficients
+
+	/**
+	 * \brief The channel interleaved input samples of all groups.
+	 *
+	 * Every group stores the last `coeff.size() - 1` rows of samples followed by room for \ref HistoryBlocks() blocks,
+	 * for the real and, with \ref Complex input, the imaginary part of the signal. The last rows are only moved back
+	 * to the start once the room is used up.
+	 */
+	AlignedStdVec<Real> history;
+	std::vector<size_t> blocks;		///< The number of blocks stored after the last rows of every group
+
+
+	/**
+	 * \brief Filter a channel interleaved block.
+	 * \param lanes The block to filter in place.
+	 * \param rows The past input samples of one part of the signal of the group, followed by room for the blocks.
+	 * \param block_index The number of blocks already stored after the last rows.
+	 */
+	void Process(Real* lanes, Real* rows, size_t block_index) const;
+
+	/**
+	 * \brief Get the number of blocks stored before the last rows are moved back.
+	 * \returns The number of blocks, which are at least as many rows as the filter has taps.
+	 */
+	size_t HistoryBlocks() const;
+
+	/**
+	 * \brief Get the number of Reals stored for one part of the signal of a group.
+	 * \returns The size of the rows passed to \ref Process().
+	 */
+	size_t RowsSize() const;
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline const std::vector<Real>& BatchFir<Tin>::Coefficients() const
+{
+	return coeff;
+}
+
+
+template<typename Tin>
+inline size_t BatchFir<Tin>::HistoryBlocks() const
+{
+	return (coeff.size() - 1) / RealSimd::static_size + 1;
+}
+
+
+template<typename Tin>
+inline size_t BatchFir<Tin>::RowsSize() const
+{
+	return (coeff.size() - 1 + HistoryBlocks() * RealSimd::static_size) * RealSimd::static_size;
+}
+
+
+#endif //FILTER_BATCH_FIR_H_
@@ -0,0 +1,39 @@
+#ifndef FILTER_BATCH_FREQUENCY_SHIFT_H_
+#define FILTER_BATCH_FREQUENCY_SHIFT_H_
+
+#include <filter/batch_filter.h>
+#include <types.h>
+#include <cstdint>
+#include <vector>
+
+
+/**\ingroup group_filters
+ * \brief Shift the frequency spectrum of many independent channels.
+ *
+ * Every channel is shifted like by its own \ref FrequencyShift in \ref NCO_SINCOSPI mode, but every channel can be
+ * shifted by a different frequency. The phases of all channels are kept in 64 bit accumulators like in a \ref Nco,
+ * and the complex exponentials of a row of \ref RealSimd::static_size channels are calculated with one `sincospi`.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class BatchFrequencyShift : public BatchFilter<Tin>
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the inputs of this filter.
+	 * \param shifts The number of Hertz to shift the frequency spectrum of every channel. Its size is the number of channels.
+	 */
+	BatchFrequencyShift(double sample_rate, const std::vector<Real>& shifts);
+
+protected:
+	virtual void ProcessGroup(size_t group, Real* lanes_real, Real* lanes_imag);
+
+private:
+	std::vector<uint64_t> phase;		///< The phase of the next sample of every channel, where `2^64` is one period
+	std::vector<uint64_t> increment;	///< The phase increment per sample of every channel
+};
+
+
+#endif //FILTER_BATCH_FREQUENCY_SHIFT_H_
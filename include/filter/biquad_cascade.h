@@ -0,0 +1,215 @@
+#ifndef FILTER_BIQUAD_CASCADE_H_
+#define FILTER_BIQUAD_CASCADE_H_
+
+#include <filter/filter.h>
+#include <types.h>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * \brief The coefficients of a single second order IIR section.
+ *
+ * The transfer function of the section is
+ * `H(z) = (b0 + b1*z^-1 + b2*z^-2) / (1 + a1*z^-1 + a2*z^-2)`.
+ * First order sections are represented by setting `b2` and `a2` to zero.
+ *
+ * The static member functions of this struct design the sections of commonly used filters.
+ */
+struct BiquadSection
+{
+	Real b0;	///< The coefficient of the current input sample
+	Real b1;	///< The coefficient of the previous input sample
+	Real b2;	///< The coefficient of the input sample before the previous one
+	Real a1;	///< The coefficient of the previous output sample
+	Real a2;	///< The coefficient of the output sample before the previous one
+
+
+	/**
+	 * \brief Design a Butterworth low pass filter.
+	 * \param sample_rate The number of samples per second the filter will process.
+	 * \param cutoff_frequency The -3dB frequency of the filter.
+	 * \param order The order of the filter. Odd orders add a first order section.
+	 * \returns The sections of the filter.
+	 */
+	static std::vector<BiquadSection> ButterworthLowPass(double sample_rate, Real cutoff_frequency, uint32_t order);
+
+	/**
+	 * \brief Design a Butterworth high pass filter.
+	 * \param sample_rate The number of samples per second the filter will process.
+	 * \param cutoff_frequency The -3dB frequency of the filter.
+	 * \param order The order of the filter. Odd orders add a first order section.
+	 * \returns The sections of the filter.
+	 */
+	static std::vector<BiquadSection> ButterworthHighPass(double sample_rate, Real cutoff_frequency, uint32_t order);
+
+	/**
+	 * \brief Design a Chebyshev type I low pass filter.
+	 * \param sample_rate The number of samples per second the filter will process.
+	 * \param cutoff_frequency The frequency at which the filter leaves the ripple band.
+	 * \param order The order of the filter. Odd orders add a first order section.
+	 * \param ripple The peak to peak ripple in the passband in dB.
+	 * \returns The sections of the filter.
+	 */
+	static std::vector<BiquadSection> ChebyshevLowPass(double sample_rate, Real cutoff_frequency, uint32_t order, Real ripple);
+
+	/**
+	 * \brief Design a Chebyshev type I high pass filter.
+	 * \param sample_rate The number of samples per second the filter will process.
+	 * \param cutoff_frequency The frequency at which the filter leaves the ripple band.
+	 * \param order The order of the filter. Odd orders add a first order section.
+	 * \param ripple The peak to peak ripple in the passband in dB.
+	 * \returns The sections of the filter.
+	 */
+	static std::vector<BiquadSection> ChebyshevHighPass(double sample_rate, Real cutoff_frequency, uint32_t order, Real ripple);
+
+	/**
+	 * \brief Design a notch filter.
+	 * \param sample_rate The number of samples per second the filter will process.
+	 * \param frequency The frequency to remove.
+	 * \param q The quality factor of the notch. Larger values give narrower notches.
+	 * \returns The section of the filter.
+	 */
+	static std::vector<BiquadSection> Notch(double sample_rate, Real frequency, Real q);
+
+	/**
+	 * \brief Design a low shelf filter.
+	 * \param sample_rate The number of samples per second the filter will process.
+	 * \param frequency The center frequency of the transition.
+	 * \param gain The gain below the transition in dB.
+	 * \param q The quality factor of the transition. This defaults to `1/sqrt(2)`.
+	 * \returns The section of the filter.
+	 */
+	static std::vector<BiquadSection> LowShelf(double sample_rate, Real frequency, Real gain, Real q = Real(0.70710678118654752));
+
+	/**
+	 * \brief Design a high shelf filter.
+	 * \param sample_rate The number of samples per second the filter will process.
+	 * \param frequency The center frequency of the transition.
+	 * \param gain The gain above the transition in dB.
+	 * \param q The quality factor of the transition. This defaults to `1/sqrt(2)`.
+	 * \returns The section of the filter.
+	 */
+	static std::vector<BiquadSection> HighShelf(double sample_rate, Real frequency, Real gain, Real q = Real(0.70710678118654752));
+
+	/**
+	 * \brief Design a DC blocker.
+	 *
+	 * This is a first order Butterworth high pass filter.
+	 *
+	 * \param sample_rate The number of samples per second the filter will process.
+	 * \param cutoff_frequency The -3dB frequency of the filter.
+	 * \returns The section of the filter.
+	 */
+	static std::vector<BiquadSection> DcBlocker(double sample_rate, Real cutoff_frequency);
+
+	/**
+	 * \brief Design a de-emphasis filter.
+	 *
+	 * This is a first order low pass filter with the corner frequency `1/(2*pi*time_constant)`.
+	 *
+	 * \param sample_rate The number of samples per second the filter will process.
+	 * \param time_constant The time constant of the de-emphasis in seconds (e.g. 50us or 75us for FM broadcast).
+	 * \returns The section of the filter.
+	 */
+	static std::vector<BiquadSection> Deemphasis(double sample_rate, Real time_constant);
+
+
+	/**
+	 * \brief Calculate the group delay of a cascade of sections.
+	 *
+	 * The group delay is evaluated at DC. If the filter does not pass DC, it is evaluated at the nyquist frequency instead.
+	 * If it passes neither, like a band pass, it is evaluated at the peak of its magnitude response.
+	 *
+	 * \param sections The sections of the filter.
+	 * \returns The group delay of the filter in samples.
+	 */
+	static double GroupDelay(const std::vector<BiquadSection>& sections);
+};
+
+
+/**\ingroup group_filters
+ * \brief A cascade of second order IIR sections.
+ *
+ * The sections are evaluated one after the other in transposed direct form II.
+ * Instead of running the recursion sample by sample, every section uses a block state space
+ * formulation: The \ref RealSimd::static_size outputs of an update are a linear combination of the
+ * inputs of the block and the two state variables at the start of the block. The matrix of this
+ * linear combination is precomputed, so a whole block is calculated with a few SIMD multiply-adds
+ * without any dependency between the output samples.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class BiquadCascade : public Filter
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param sections The sections of the filter, e.g. designed with \ref BiquadSection::ButterworthLowPass.
+	 */
+	BiquadCascade(double sample_rate, const std::vector<BiquadSection>& sections);
+
+
+	/**
+	 * \brief Update the output of this filter.
+	 */
+	virtual void Update();
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 *
+	 * The frequency at which the group delay is evaluated is chosen by \ref BiquadSection::GroupDelay.
+	 *
+	 * \returns The group delay of this filter in seconds.
+	 */
+	virtual double GroupDelay() const;
+
+
+	/**
+	 * \brief Get the sections of this filter.
+	 * \returns The sections of this filter.
+	 */
+	const std::vector<BiquadSection>& Sections() const;
+
+private:
+	const std::vector<BiquadSection> sections;	///< The coefficients of the sections
+
+	/**
+	 * \brief The block state space matrices of all sections.
+	 *
+	 * For every section there are `RealSimd::static_size + 2` columns of size RealSimd::static_size.
+	 * The first two columns map the state variables and the remaining ones the input samples to the outputs.
+	 */
+	AlignedStdVec<Real> block_coefficients;
+
+	std::vector<Real> state_real;	///< The two state variables of every section for the real part of the signal
+	std::vector<Real> state_imag;	///< The two state variables of every section for the imaginary part of the signal
+
+
+	/**
+	 * \brief Calculate the block state space matrices of all sections.
+	 */
+	void InitBlockCoefficients();
+
+	/**
+	 * \brief Filter one block of samples through all sections.
+	 * \param in A pointer to RealSimd::static_size input samples.
+	 * \param out A pointer to RealSimd::static_size output samples.
+	 * \param state The state variables of the sections.
+	 */
+	void Process(const Real* in, Real* out, std::vector<Real>& state) const;
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline const std::vector<BiquadSection>& BiquadCascade<Tin>::Sections() const
+{
+	return sections;
+}
+
+
+#endif //FILTER_BIQUAD_CASCADE_H_
\ No newline at end of file
@@ -0,0 +1,156 @@
+#ifndef FILTER_CORRELATOR_H_
+#define FILTER_CORRELATOR_H_
+
+#include <filter/filter.h>
+#include <filter/fft.h>
+#include <filter/sample_history.h>
+#include <types.h>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+/**
+ * \brief The way a \ref Correlator calculates the correlation.
+ */
+enum CorrelatorMethod {
+	CORRELATOR_AUTO,	///< Use \ref CORRELATOR_FFT for patterns longer than 128 samples and \ref CORRELATOR_DIRECT otherwise.
+	CORRELATOR_DIRECT,	///< Multiply the pattern with the input at every offset. Costs `pattern.size()` multiplications per sample, but adds no delay.
+	CORRELATOR_FFT		///< Correlate a few times the length of the pattern at once via \ref FftPlan. The cost grows only logarithmically with the pattern length, but the output is delayed.
+};
+
+
+/**
+ * \brief A position at which the input matches the pattern of a \ref Correlator.
+ */
+struct CorrelationPeak {
+	int64_t index;	///< The number of the input sample at which the pattern starts
+	Real score;		///< The correlation at this position
+};
+
+
+/**
+ * \brief Correlate a signal with a pattern at consecutive offsets.
+ *
+ * Calculates `out[i] = sum(pattern[k] * samples[i + k])` for every `i` in `[0, count)`.
+ * Each pattern element is multiplied with a whole SIMD register of offsets at once.
+ *
+ * \param samples The signal. Has to contain `count + pattern.size() - 1` samples.
+ * \param count The number of offsets to calculate.
+ * \param pattern The pattern to look for.
+ * \param out An array of `count` elements receiving the correlation.
+ */
+void Correlate(const Real* samples, size_t count, const std::vector<Real>& pattern, Real* out);
+
+
+/**\ingroup group_filters
+ * \brief Correlate the input signal with a known pattern.
+ *
+ * The output at sample `n` is the correlation of the pattern with the input samples `n - pattern.size() + 1` to `n`
+ * (delayed by the block length in \ref CORRELATOR_FFT mode). Every sample of the output is also checked for peaks:
+ * A score above the threshold becomes a \ref CorrelationPeak, unless there is a higher score less than
+ * the minimum distance away from it. The peaks are collected until they are taken by \ref TakePeaks().
+ *
+ * \tparam Tin The type of input this filter accepts. Has to be \ref Real.
+ */
+template<typename Tin>
+class Correlator : public Filter
+{
+	static_assert(std::is_same<Tin, Real>::value, "Correlator needs a Real input signal!");
+
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param pattern The pattern to correlate the input with.
+	 * \param threshold The minimum score of a peak. This defaults to infinity, which disables the peak detection.
+	 * \param min_distance The minimum number of samples between two peaks. A value of 0 uses the length of the pattern. This defaults to 0.
+	 * \param method The way the correlation is calculated. This defaults to \ref CORRELATOR_AUTO.
+	 */
+	Correlator(double sample_rate, const std::vector<Real>& pattern, Real threshold = std::numeric_limits<Real>::infinity(), uint32_t min_distance = 0, CorrelatorMethod method = CORRELATOR_AUTO);
+
+
+	/**
+	 * \brief Update the output of this filter.
+	 */
+	virtual void Update();
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 * \returns The time between the start of the pattern at the input and its correlation peak at the output.
+	 */
+	virtual double GroupDelay() const;
+
+
+	/**
+	 * \brief Get the peaks found since the last call.
+	 *
+	 * The highest score is only reported once no higher one can follow within the minimum distance. At the end of the
+	 * stream, this never happens for the last peak, so it is only reported if `final` is set.
+	 *
+	 * \param final Wether the input ended, so the highest score found since the last peak is reported as well. This defaults to `false`.
+	 * \returns The peaks in the order they occured.
+	 */
+	std::vector<CorrelationPeak> TakePeaks(bool final = false);
+
+	/**
+	 * \brief Get the way the correlation is calculated.
+	 * \returns Either \ref CORRELATOR_DIRECT or \ref CORRELATOR_FFT.
+	 */
+	CorrelatorMethod Method() const;
+
+private:
+	const std::vector<Real> pattern;	///< The pattern to correlate the input with
+	const CorrelatorMethod method;		///< The way the correlation is calculated
+	const Real threshold;				///< The minimum score of a peak
+	const uint32_t min_distance;		///< The minimum number of samples between two peaks
+
+	SampleHistory history;				///< The input samples needed for the next correlation
+	int64_t sample_count = 0;			///< The number of input samples before the current block
+
+	std::shared_ptr<const FftPlan> fft;			///< The FFT used in \ref CORRELATOR_FFT mode
+	size_t fft_step = 0;						///< The number of scores calculated per FFT
+	AlignedStdVec<Real> pattern_real;			///< The real part of the complex conjugate of the spectrum of the pattern, scaled by the inverse FFT length
+	AlignedStdVec<Real> pattern_imag;			///< The imaginary part of the complex conjugate of the spectrum of the pattern, scaled by the inverse FFT length
+	AlignedStdVec<Real> fft_real;				///< Scratch buffer for the real part of the FFT
+	AlignedStdVec<Real> fft_imag;				///< Scratch buffer for the imaginary part of the FFT
+	AlignedStdVec<Real> fft_scores;				///< The scores of the last FFT, which are put out block by block
+	size_t fft_position = 0;					///< The index of the next block in \ref fft_scores
+
+	bool has_candidate = false;			///< Wether \ref candidate is a valid peak
+	CorrelationPeak candidate;			///< The highest score above the threshold, that might still be exceeded
+	std::vector<CorrelationPeak> peaks;	///< The peaks found since the last call to \ref TakePeaks()
+
+	/**
+	 * \brief Correlate the last \ref fft_step samples via FFT.
+	 */
+	void CorrelateFft();
+
+	/**
+	 * \brief Look for peaks in the current output block.
+	 * \param first The number of the input sample at which the pattern of the first score ends.
+	 */
+	void FindPeaks(int64_t first);
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline double Correlator<Tin>::GroupDelay() const
+{
+	const size_t delay = pattern.size() - 1 + (method == CORRELATOR_FFT ? fft_step : 0);
+	return delay * DeltatimeIn();
+}
+
+
+template<typename Tin>
+inline CorrelatorMethod Correlator<Tin>::Method() const
+{
+	return method;
+}
+
+
+#endif //FILTER_CORRELATOR_H_
\ No newline at end of file
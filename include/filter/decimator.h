@@ -0,0 +1,97 @@
+#ifndef FILTER_DECIMATOR_H_
+#define FILTER_DECIMATOR_H_
+
+#include <filter/filter.h>
+#include <filter/sample_history.h>
+#include <filter/window_functions.h>
+#include <types.h>
+#include <cstdint>
+#include <functional>
+
+
+/**\ingroup group_filters
+ * \brief Low pass filter the input signal and reduce its sample rate by an integer factor.
+ *
+ * Every call to \ref Update() consumes one block of the input. After `factor` blocks, a new block of
+ * output samples is calculated and \ref OutputReady() returns `true` until the next call to \ref Update().
+ * Filters connected to the output of a Decimator must only be updated while \ref OutputReady() is `true`.
+ * The anti aliasing filter is a windowed sinc, which is only evaluated at the samples that are kept.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class Decimator : public Filter
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param factor The factor by which the sample rate is reduced.
+	 * \param cutoff_frequency The cutoff frequency of the anti aliasing filter. Should be below `sample_rate / factor / 2`.
+	 * \param tapcount The number of taps of the anti aliasing filter.
+	 * \param window_function The window function to weigh the coefficients with. This defaults to \ref Hamming.
+	 */
+	Decimator(double sample_rate, uint32_t factor, Real cutoff_frequency, uint32_t tapcount, const std::function<Real(Real)>& window_function = Hamming);
+
+
+	/**
+	 * \brief Update the output of this filter.
+	 */
+	virtual void Update();
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 * \returns The delay of the anti aliasing filter, which is `(tapcount-1)/2` input samples.
+	 */
+	virtual double GroupDelay() const;
+
+
+	/**
+	 * \brief Check if the last call to \ref Update() produced a new block of output samples.
+	 * \returns `true` if the output contains a new block of samples.
+	 */
+	bool OutputReady() const;
+
+private:
+	const uint32_t tapcount;	///< The number of taps of the anti aliasing filter
+
+	/**
+	 * \brief The reversed coefficients of the anti aliasing filter.
+	 *
+	 * Zeros are prepended to round the length up to a multiple of \ref RealSimd::static_size,
+	 * so the coefficients can be multiplied with the input one whole register at a time.
+	 */
+	AlignedStdVec<Real> coefficients;
+
+	SampleHistory history_real;	///< The most recent samples of the real part of the input
+	SampleHistory history_imag;	///< The most recent samples of the imaginary part of the input
+
+	uint32_t block_count = 0;	///< The number of input blocks since the last output block
+	bool output_ready = false;	///< Wether the last update produced an output block
+
+	/**
+	 * \brief Calculate the output samples of the last `factor` input blocks.
+	 * \param history The input samples
+	 * \param out The output array with \ref RealSimd::static_size elements.
+	 */
+	void Decimate(const SampleHistory& history, Real* out) const;
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline double Decimator<Tin>::GroupDelay() const
+{
+	return (tapcount - 1) / 2.0 * DeltatimeIn();
+}
+
+
+template<typename Tin>
+inline bool Decimator<Tin>::OutputReady() const
+{
+	return output_ready;
+}
+
+
+#endif //FILTER_DECIMATOR_H_
\ No newline at end of file
@@ -25,6 +25,12 @@ public:
 	 */
 	virtual void Update();
 
+	/**
+	 * \brief Get the group delay of this filter.
+	 * \returns The group delay of the backward difference, which is half a sample.
+	 */
+	virtual double GroupDelay() const;
+
 private:
 	/**
 	 * \brief The factor needed to output the correct derivative of the input signal.
@@ -40,4 +46,13 @@ private:
 };
 
 
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline double Differentiator<Tin>::GroupDelay() const
+{
+	return DeltatimeIn() / 2;
+}
+
+
 #endif //FILTER_DIFFERENTIATOR_H_
\ No newline at end of file
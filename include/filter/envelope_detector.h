@@ -0,0 +1,34 @@
+#ifndef FILTER_ENVELOPE_DETECTOR_H_
+#define FILTER_ENVELOPE_DETECTOR_H_
+
+#include <filter/filter.h>
+#include <types.h>
+
+
+/**\ingroup group_filters
+ * \brief Calculate the magnitude of the input signal.
+ *
+ * Applied to the output of an \ref AnalyticSignal filter, the magnitude is the envelope of an amplitude modulated signal.
+ * For a \ref Real input, the output is the absolute value of the input.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class EnvelopeDetector : public Filter
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 */
+	EnvelopeDetector(double sample_rate);
+
+
+	/**
+	 * \brief Update the output of this filter.
+	 */
+	virtual void Update();
+};
+
+
+#endif //FILTER_ENVELOPE_DETECTOR_H_
\ No newline at end of file
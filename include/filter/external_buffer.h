@@ -0,0 +1,54 @@
+#ifndef FILTER_EXTERNAL_BUFFER_H_
+#define FILTER_EXTERNAL_BUFFER_H_
+
+#include <types.h>
+#include <cstddef>
+#include <functional>
+
+
+/**
+ * \file filter/external_buffer.h
+ * \brief The memory of a host application, which an \ref ExternalBufferInput reads from or an \ref ExternalBufferOutput writes to.
+ */
+
+
+/**
+ * \brief The way the samples are laid out in an \ref ExternalBuffer.
+ *
+ * Both layouts are the same for \ref Real samples.
+ */
+enum ExternalBufferLayout {
+	EXTERNAL_BUFFER_SPLIT,			///< The real and the imaginary parts are stored in separate arrays, like the filter outputs
+	EXTERNAL_BUFFER_INTERLEAVED		///< The real and the imaginary parts alternate in one array, like a `std::complex` array
+};
+
+
+/**
+ * \brief A view of samples owned by the caller.
+ *
+ * The filters never allocate, free or keep a copy of the memory. It has to stay valid until the filter
+ * hands it back through its callback or is destroyed.
+ *
+ * \tparam T Either `const Real` for an \ref ExternalBufferInput or \ref Real for an \ref ExternalBufferOutput.
+ */
+template<typename T>
+struct ExternalBuffer {
+	T* real = nullptr;	///< The real parts of the samples. With \ref EXTERNAL_BUFFER_INTERLEAVED, all `2 * size` values.
+	T* imag = nullptr;	///< The imaginary parts of the samples. Only used for \ref Complex samples with \ref EXTERNAL_BUFFER_SPLIT.
+	size_t size = 0;	///< The number of samples
+};
+
+
+/**
+ * \brief A function giving a filter the next buffer.
+ *
+ * The function is called with the current buffer once the filter is done with it, and sets it to the next one.
+ * Returning `false` ends the data.
+ *
+ * \tparam T Either `const Real` for an \ref ExternalBufferInput or \ref Real for an \ref ExternalBufferOutput.
+ */
+template<typename T>
+using ExternalBufferCallback = std::function<bool(ExternalBuffer<T>& buffer)>;
+
+
+#endif //FILTER_EXTERNAL_BUFFER_H_
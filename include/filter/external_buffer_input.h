@@ -0,0 +1,74 @@
+#ifndef FILTER_EXTERNAL_BUFFER_INPUT_H_
+#define FILTER_EXTERNAL_BUFFER_INPUT_H_
+
+#include <filter/external_buffer.h>
+#include <filter/filter.h>
+#include <types.h>
+#include <cstddef>
+
+
+/**\ingroup group_filters
+ * \brief Provides the samples in the memory of a host application as input to other filters.
+ *
+ * Unlike a \ref VectorInput, the samples are neither copied nor moved into the filter. Every update copies the next
+ * block straight from the \ref ExternalBuffer into the outputs, which for \ref EXTERNAL_BUFFER_SPLIT is a plain copy
+ * and for \ref EXTERNAL_BUFFER_INTERLEAVED the same SIMD deinterleave as for two channel WAVE files.
+ * Once a buffer is used up, the callback is asked for the next one, so the host can refill it or pass on another one.
+ * After the end of the data, the output is 0.
+ *
+ * \tparam Tout The type of output this filter provides. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tout>
+class ExternalBufferInput : public Filter
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second this filter outputs.
+	 * \param buffer The first buffer to read the samples from. It may be empty, if the callback provides the first one.
+	 * \param layout The way the samples are laid out in the buffers. This defaults to \ref EXTERNAL_BUFFER_SPLIT.
+	 * \param refill The function giving the next buffer, once a buffer is used up. If it is empty,
+	 *               the data ends with the first buffer. This defaults to an empty function.
+	 */
+	ExternalBufferInput(double sample_rate, const ExternalBuffer<const Real>& buffer, ExternalBufferLayout layout = EXTERNAL_BUFFER_SPLIT,
+		const ExternalBufferCallback<const Real>& refill = nullptr);
+
+
+	/**
+	 * \brief Update the output of this filter.
+	 */
+	virtual void Update();
+
+
+	/**
+	 * \brief Check if the end of the data is reached.
+	 * \returns `true` if the last buffer is used up and the callback ended the data.
+	 */
+	bool EndOfData() const;
+
+private:
+	ExternalBuffer<const Real> buffer;			///< The buffer the samples are read from
+	const ExternalBufferLayout layout;			///< The way the samples are laid out in the buffers
+	ExternalBufferCallback<const Real> refill;	///< The function giving the next buffer
+	size_t position = 0;						///< The index of the next sample in \ref buffer
+	bool end_of_data = false;					///< Wether the callback ended the data
+
+	/**
+	 * \brief Copy samples from the buffer to the output.
+	 * \param offset The index of the first output sample to write.
+	 * \param count The number of samples to copy.
+	 */
+	void Copy(size_t offset, size_t count);
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tout>
+inline bool ExternalBufferInput<Tout>::EndOfData() const
+{
+	return end_of_data;
+}
+
+
+#endif //FILTER_EXTERNAL_BUFFER_INPUT_H_
@@ -0,0 +1,80 @@
+#ifndef FILTER_EXTERNAL_BUFFER_OUTPUT_H_
+#define FILTER_EXTERNAL_BUFFER_OUTPUT_H_
+
+#include <filter/external_buffer.h>
+#include <filter/filter.h>
+#include <types.h>
+#include <cstddef>
+
+
+/**\ingroup group_filters
+ * \brief Writes the input signal into the memory of a host application.
+ *
+ * Unlike a \ref VectorOutput, nothing is allocated or appended. Every update copies a block straight into the
+ * \ref ExternalBuffer, which for \ref EXTERNAL_BUFFER_SPLIT is a plain copy and for \ref EXTERNAL_BUFFER_INTERLEAVED
+ * the same SIMD interleave as for two channel files. Once a buffer is full, it is handed to the callback with its
+ * size, which sets the next buffer to fill. Samples arriving without a buffer are dropped.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class ExternalBufferOutput : public Filter
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param buffer The first buffer to write the samples to. It may be empty, if the callback provides the first one.
+	 * \param layout The way the samples are laid out in the buffers. This defaults to \ref EXTERNAL_BUFFER_SPLIT.
+	 * \param flush The function taking a full buffer, whose size is the number of samples written, and giving the next one.
+	 *              If it is empty, the samples after the first buffer are dropped. This defaults to an empty function.
+	 */
+	ExternalBufferOutput(double sample_rate, const ExternalBuffer<Real>& buffer, ExternalBufferLayout layout = EXTERNAL_BUFFER_SPLIT,
+		const ExternalBufferCallback<Real>& flush = nullptr);
+
+
+	/**
+	 * \brief Update this filter.
+	 */
+	virtual void Update();
+
+
+	/**
+	 * \brief Hand the current buffer to the callback, even if it isn't full.
+	 *
+	 * The size of the buffer passed to the callback is the number of samples written to it.
+	 */
+	void Flush();
+
+	/**
+	 * \brief Get the fill level of the current buffer.
+	 * \returns The number of samples written to the current buffer.
+	 */
+	size_t Written() const;
+
+private:
+	ExternalBuffer<Real> buffer;		///< The buffer the samples are written to
+	const ExternalBufferLayout layout;	///< The way the samples are laid out in the buffers
+	ExternalBufferCallback<Real> flush;	///< The function taking a full buffer and giving the next one
+	size_t position = 0;				///< The index of the next sample in \ref buffer
+	bool end_of_data = false;			///< Wether the callback ended the data
+
+	/**
+	 * \brief Copy samples from the input to the buffer.
+	 * \param offset The index of the first input sample to copy.
+	 * \param count The number of samples to copy.
+	 */
+	void Copy(size_t offset, size_t count);
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline size_t ExternalBufferOutput<Tin>::Written() const
+{
+	return position;
+}
+
+
+#endif //FILTER_EXTERNAL_BUFFER_OUTPUT_H_
@@ -0,0 +1,55 @@
+#ifndef FILTER_FAST_MATH_H_
+#define FILTER_FAST_MATH_H_
+
+#include <types.h>
+#include <limits>
+#include <boost/simd/pack.hpp>
+#include <boost/simd/function/abs.hpp>
+#include <boost/simd/function/copysign.hpp>
+#include <boost/simd/function/if_else.hpp>
+#include <boost/simd/function/max.hpp>
+#include <boost/simd/function/min.hpp>
+#include <boost/math/constants/constants.hpp>
+
+
+/**
+ * \file filter/fast_math.h
+ * \brief Fast approximations of mathematical functions on whole SIMD Registers.
+ *
+ * These functions trade some accuracy for speed. They do not contain any branches,
+ * so the compiler can evaluate all elements of a register at once.
+ */
+
+
+/**
+ * \brief Approximate the four quadrant arcus tangent of `y/x`.
+ *
+ * The arcus tangent of the ratio of the smaller and the larger magnitude is approximated with
+ * the odd polynomial of degree 9 from Abramowitz and Stegun 4.4.49. The result is then mirrored into the correct
+ * octant. The absolute error is below `1.2e-5` radians. `FastAtan2(0, 0)` returns `0`.
+ *
+ * \param y The imaginary parts.
+ * \param x The real parts.
+ * \returns The angles of the vectors `(x, y)` in the interval `[-pi, pi]`.
+ */
+inline RealSimd FastAtan2(const RealSimd& y, const RealSimd& x)
+{
+	const RealSimd abs_x = boost::simd::abs(x);
+	const RealSimd abs_y = boost::simd::abs(y);
+	const RealSimd larger = boost::simd::max(abs_x, abs_y);
+	const RealSimd smaller = boost::simd::min(abs_x, abs_y);
+	//Avoid dividing by zero for the zero vector
+	const RealSimd a = smaller / boost::simd::max(larger, RealSimd(std::numeric_limits<Real>::min()));
+	const RealSimd s = a * a;
+	RealSimd r = RealSimd(Real(0.0208351));
+	r = r * s - RealSimd(Real(0.0851330));
+	r = r * s + RealSimd(Real(0.1801410));
+	r = r * s - RealSimd(Real(0.3302995));
+	r = (r * s + RealSimd(Real(0.9998660))) * a;
+	r = boost::simd::if_else(abs_y > abs_x, RealSimd(boost::math::constants::half_pi<Real>()) - r, r);
+	r = boost::simd::if_else(x < RealSimd(0), RealSimd(boost::math::constants::pi<Real>()) - r, r);
+	return boost::simd::copysign(r, y);
+}
+
+
+#endif //FILTER_FAST_MATH_H_
\ No newline at end of file
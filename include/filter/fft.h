@@ -0,0 +1,100 @@
+#ifndef FILTER_FFT_H_
+#define FILTER_FFT_H_
+
+#include <types.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+/**
+ * \file filter/fft.h
+ * \brief A radix-2 FFT working on separate arrays for the real and imaginary parts.
+ */
+
+
+/**
+ * \brief The precomputed tables of a FFT of a given size.
+ *
+ * The FFT is an iterative radix-2 decimation in time on the split real/imaginary layout used by the
+ * filter outputs. Once the butterflies span at least one SIMD register, they are calculated a whole register
+ * at a time. Plans are created through \ref Get(), which returns the same plan to everyone asking for a size,
+ * so the bit reversal and twiddle tables are calculated only once.
+ */
+class FftPlan
+{
+public:
+	/**
+	 * \brief Get the plan for a FFT of a given size.
+	 * \param size The length of the FFT. Has to be a power of two.
+	 * \returns The shared plan for FFTs of length `size`.
+	 */
+	static std::shared_ptr<const FftPlan> Get(size_t size);
+
+
+	/**
+	 * \brief Calculate the FFT in place.
+	 *
+	 * The result is not normalized, i.e. `X[k] = sum(x[n] * exp(-2*pi*i*k*n/size))`.
+	 *
+	 * \param real The real part of the signal. Has to be aligned for SIMD loads.
+	 * \param imag The imaginary part of the signal. Has to be aligned for SIMD loads.
+	 */
+	void Forward(Real* real, Real* imag) const;
+
+	/**
+	 * \brief Calculate the inverse FFT in place.
+	 *
+	 * The result is not normalized, so `Inverse(Forward(x))` returns `size` times `x`.
+	 *
+	 * \param real The real part of the spectrum. Has to be aligned for SIMD loads.
+	 * \param imag The imaginary part of the spectrum. Has to be aligned for SIMD loads.
+	 */
+	void Inverse(Real* real, Real* imag) const;
+
+	/**
+	 * \brief Get the length of the FFT.
+	 * \returns The number of samples transformed by this plan.
+	 */
+	size_t Size() const;
+
+private:
+	/**
+	 * \brief Constructor
+	 * \param size The length of the FFT.
+	 */
+	FftPlan(size_t size);
+
+	const size_t size;	///< The length of the FFT
+
+	std::vector<std::pair<uint32_t, uint32_t>> swaps;	///< The pairs of indices swapped by the bit reversal permutation
+
+	/**
+	 * \brief The twiddle factors of all stages.
+	 *
+	 * The stage combining blocks of `h` samples uses the factors `exp(-pi*i*j/h)` for `j` in `[0, h)`,
+	 * which are stored at the indices `h + j`. That way, the factors of every stage are contiguous
+	 * and aligned once `h` is a multiple of \ref RealSimd::static_size.
+	 */
+	AlignedStdVec<Real> twiddle_real;
+	AlignedStdVec<Real> twiddle_imag;	///< The imaginary parts of the twiddle factors, see \ref twiddle_real
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+inline size_t FftPlan::Size() const
+{
+	return size;
+}
+
+
+inline void FftPlan::Inverse(Real* real, Real* imag) const
+{
+	//Swapping real and imaginary part conjugates the input and the output of the FFT
+	Forward(imag, real);
+}
+
+
+#endif //FILTER_FFT_H_
\ No newline at end of file
@@ -158,6 +158,17 @@ public:
 	*/
 	double DeltatimeOut() const;
 
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 *
+	 * Filters which delay the signal passing through them (e.g. \ref Fir) override this function.
+	 * Summing up the group delays of all filters in a chain gives the latency of the whole chain.
+	 *
+	 * \returns The group delay of this filter in seconds.
+	 */
+	virtual double GroupDelay() const;
+
 protected:
 	/**
 	 * \brief Add a new output to this filter.
@@ -269,6 +280,12 @@ private:
 
 //---------- inlined / templated functions implementation ----------//
 
+inline uint32_t Filter::DecimationFactor() const
+{
+	return decimation_factor;
+}
+
+
 inline double Filter::SampleRateIn() const
 {
 	return sample_rate;
@@ -305,6 +322,12 @@ inline double Filter::DeltatimeOut() const
 }
 
 
+inline double Filter::GroupDelay() const
+{
+	return 0;
+}
+
+
 inline const Real* Filter::GetReal(size_t index) const
 {
 	#if ASSERT_FILTER_OUTPUT_TYPE
@@ -27,7 +27,8 @@ using FirBaseType = std::conditional_t<tapcount < TAPCOUNT_FOR_SIMD_FIR, FirNoSi
  * \brief A Finite Impulse Response filter.
  *
  * Convolves the input signal with the filter coefficients.
- * Has a `tapcount/2` samples delay to make it causal.
+ * Symmetric (linear phase) coefficients delay the signal by `(tapcount-1)/2` samples.
+ * The actual delay of the used coefficients is reported by \ref GroupDelay().
  *
  * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
  * \tparam typcount The number of taps this filter has. This defaults to \ref FilterSize::DYNAMIC.
@@ -0,0 +1,67 @@
+#ifndef FILTER_FIR_DESIGN_H_
+#define FILTER_FIR_DESIGN_H_
+
+#include <types.h>
+#include <filter/window_functions.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+
+/**
+ * \file filter/fir_design.h
+ * \brief Tools to transform and analyze the coefficients of FIR filters.
+ */
+
+
+/**
+ * \brief The phase response a designed FIR filter should have.
+ */
+enum FirPhase {
+	LINEAR_PHASE,	///< Keep the symmetric coefficients of the design. The filter delays every frequency by `(tapcount-1)/2` samples.
+	MINIMUM_PHASE	///< Convert the design to minimum phase. The magnitude response stays the same but the group delay is much smaller.
+};
+
+
+/**
+ * \brief Convert the coefficients of a FIR filter to minimum phase.
+ *
+ * The conversion is done via the real cepstrum of the frequency response. The resulting
+ * filter has the same magnitude response as the original one (up to numerical errors in the
+ * stopband) and the same number of taps, but most of its energy is moved to the first taps.
+ * This trades the linear phase of the original filter for a much smaller delay.
+ *
+ * \param coeff The coefficients of the FIR filter to convert.
+ * \returns The coefficients of the minimum phase FIR filter.
+ */
+std::vector<Real> MinimumPhase(const std::vector<Real>& coeff);
+
+
+/**
+ * \brief Calculate the group delay of a FIR filter.
+ *
+ * The group delay is evaluated at DC. If the filter does not pass DC (e.g. a high pass filter),
+ * it is evaluated at the nyquist frequency instead.
+ *
+ * \param coeff The coefficients of the FIR filter.
+ * \returns The group delay of the filter in samples, or 0 if there are no coefficients.
+ */
+Real FirGroupDelay(const std::vector<Real>& coeff);
+
+
+/**
+ * \brief Design the coefficients of a windowed sinc low pass filter.
+ *
+ * These are the coefficients used by a \ref LowPass, e.g. to run the same filter in a \ref BatchFir.
+ *
+ * \param sample_rate The number of samples per second at the input of the filter.
+ * \param cutoff_frequency The cutoff frequency of the low pass filter.
+ * \param tapcount The number of taps of the filter.
+ * \param window_function The window function to weigh the coefficients with. This defaults to \ref Rectangular.
+ * \param phase The phase response of the filter. This defaults to \ref LINEAR_PHASE.
+ * \returns The coefficients of the FIR filter.
+ */
+std::vector<Real> LowPassCoefficients(double sample_rate, Real cutoff_frequency, uint32_t tapcount, const std::function<Real(Real)>& window_function = Rectangular, FirPhase phase = LINEAR_PHASE);
+
+
+#endif //FILTER_FIR_DESIGN_H_
\ No newline at end of file
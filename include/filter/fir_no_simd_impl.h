@@ -6,6 +6,7 @@
 #include <types.h>
 #include <vector>
 #include <boost/circular_buffer.hpp>
+#include <filter/fir_design.h>
 
 
 ///\cond IMPLEMENTATION_DETAILS
@@ -17,14 +18,24 @@ public:
 
 	virtual void Update();
 
+	virtual double GroupDelay() const;
+
 protected:
 	void SetCoefficients(const std::vector<Real>& coeff);
 
 private:
 	std::vector<Real> coefficients;
+	Real group_delay;		///< The group delay of the filter in samples
 	boost::circular_buffer<Real> buffer_real;
 	boost::circular_buffer<Real> buffer_imag;
 };
+
+
+template<typename Tin>
+inline double FirNoSimdImpl<Tin>::GroupDelay() const
+{
+	return group_delay * DeltatimeIn();
+}
 ///\endcond
 
 
@@ -8,6 +8,7 @@
 #include <boost/circular_buffer.hpp>
 #include <cstring>
 #include <boost/simd/reduction.hpp>
+#include <filter/fir_design.h>
 
 
 ///\cond IMPLEMENTATION_DETAILS
@@ -19,6 +20,8 @@ public:
 
 	virtual void Update();
 
+	virtual double GroupDelay() const;
+
 protected:
 	void SetCoefficients(const std::vector<Real>& coefficients);
 
@@ -42,6 +45,7 @@ private:
 
 	uint32_t offset = 0;		///< The offset the currently first sample has in the buffers.
 	uint32_t deltaoffset;		///< The difference between the tapcount of the filter and the number of samples stored in a buffer
+	Real group_delay;			///< The group delay of the filter in samples
 
 
 	void UpdateInputBuffers();
@@ -49,6 +53,13 @@ private:
 };
 
 
+template<typename Tin>
+inline double FirSimdImpl<Tin>::GroupDelay() const
+{
+	return group_delay * DeltatimeIn();
+}
+
+
 template<>
 inline void FirSimdImpl<Real>::UpdateInputBuffers()
 {
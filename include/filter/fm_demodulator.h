@@ -0,0 +1,94 @@
+#ifndef FILTER_FM_DEMODULATOR_H_
+#define FILTER_FM_DEMODULATOR_H_
+
+#include <filter/filter.h>
+#include <types.h>
+#include <type_traits>
+
+
+/**\ingroup group_filters
+ * \brief A Frequency Demodulator
+ *
+ * This filter calculates the instantaneous frequency of a \ref Complex input signal with a polar discriminator:
+ * The angle of `conj(x[n-1]) * x[n]` is the phase difference between two consecutive samples.
+ * The angles of a whole block are calculated at once with \ref FastAtan2.
+ * The \ref Real output is scaled like the input of a \ref FrequencyModulator, so demodulating the
+ * output of a \ref FrequencyModulator with the same carrier frequency and bandwidth yields its input.
+ *
+ * \tparam Tin The type of input this filter accepts. Has to be \ref Complex.
+ */
+template<typename Tin>
+class FmDemodulator : public Filter
+{
+	static_assert(std::is_same<Tin, Complex>::value, "FmDemodulator needs a Complex input signal!");
+
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second this filter takes as an input.
+	 * \param frequency The frequency of the carrier wave. This defaults to 0Hz.
+	 * \param bandwidth The bandwidth of the signal. An output in the range `[-1, 1]` corresponds to the frequencies
+	 *                  `frequency - bandwidth/2` to `frequency + bandwidth/2`. This defaults to 1Hz.
+	 */
+	FmDemodulator(double sample_rate, Real frequency = Real(0), Real bandwidth = Real(1));
+
+
+	/**
+	 * \brief Update the output of this filter.
+	 */
+	virtual void Update();
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 * \returns The group delay of the phase difference, which is half a sample.
+	 */
+	virtual double GroupDelay() const;
+
+
+	/**
+	 * \brief Get the Frequency of the carrier wave.
+	 * \returns The frequency of the carrier wave.
+	 */
+	Real Frequency() const;
+
+	/**
+	 * \brief Get the bandwidth of the signal.
+	 * \returns The bandwidth of the signal.
+	 */
+	Real Bandwidth() const;
+
+private:
+	const Real frequency;	///< The frequency of the carrier wave.
+	const Real bandwidth;	///< The bandwidth of the signal.
+	const Real scale;		///< The factor converting a phase difference to the output
+	const Real offset;		///< The output corresponding to the carrier frequency
+
+	RealSimd last_real;		///< The real part of the previous input block
+	RealSimd last_imag;		///< The imaginary part of the previous input block
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline double FmDemodulator<Tin>::GroupDelay() const
+{
+	return DeltatimeIn() / 2;
+}
+
+
+template<typename Tin>
+inline Real FmDemodulator<Tin>::Frequency() const
+{
+	return frequency;
+}
+
+
+template<typename Tin>
+inline Real FmDemodulator<Tin>::Bandwidth() const
+{
+	return bandwidth;
+}
+
+
+#endif //FILTER_FM_DEMODULATOR_H_
\ No newline at end of file
@@ -2,9 +2,9 @@
 #define FILTER_FREQUENCY_GENERATOR_H_
 
 #include <filter/filter.h>
+#include <filter/nco.h>
 #include <types.h>
 #include <boost/simd/pack.hpp>
-#include <boost/simd/trigonometric.hpp>
 #include <boost/simd/function/aligned_store.hpp>
 
 
@@ -24,8 +24,9 @@ public:
 	 * \param frequency The frequency of the generated waveform. This defaults to `1`Hz.
 	 * \param amplitude The amplitude of the generated waveform. This defaults to `1`.
 	 * \param phaseshift The phaseshift of the generated waveform in the interval `[0, 2pi)`. This defaults to `0`.
+	 * \param mode The way the oscillator calculates the waveform. This defaults to \ref NCO_SINCOSPI.
 	 */
-	FrequencyGenerator(double sample_rate, Real frequency = Real(1), Real amplitude = Real(1), Real phaseshift = Real(0));
+	FrequencyGenerator(double sample_rate, Real frequency = Real(1), Real amplitude = Real(1), Real phaseshift = Real(0), NcoMode mode = NCO_SINCOSPI);
 
 
 	/**
@@ -78,14 +79,9 @@ protected:
 
 	
 	/**
-	 * \brief The current phase of the signal divided by `pi`.
+	 * \brief The oscillator keeping track of the phase of the signal.
 	 */
-	RealSimd phase_div_pi;
-
-	/**
-	 * \brief Initializes the phase of the signal.
-	 */
-	void InitPhase();
+	Nco nco;
 
 	/**
 	 * \brief Updates the phase of the signal.
@@ -96,7 +92,7 @@ protected:
 
 	
 	/**
-	 * \brief Calculate the output using the current phase stores in \ref phase_div_pi.
+	 * \brief Calculate the output using the current phase stored in \ref nco.
 	 */
 	void CalculateOutput();
 };
@@ -135,10 +131,7 @@ inline Real FrequencyGenerator<Tout>::Phaseshift() const
 template<typename Tout>
 inline void FrequencyGenerator<Tout>::UpdatePhase()
 {
-	phase_div_pi += RealSimd(2 * frequency * RealSimd::static_size * DeltatimeOut());
-	//Subtract 2 (period of boost::simd::sincospi) as soon as the first value is bigger than 1
-	if (phase_div_pi[RealSimd::static_size / 2] > 1)
-		phase_div_pi -= RealSimd(2);
+	nco.Advance();
 }
 
 
@@ -146,8 +139,7 @@ inline void FrequencyGenerator<Tout>::UpdatePhase()
 template<>
 inline void FrequencyGenerator<Real>::CalculateOutput()
 {
-	auto result = boost::simd::cospi(phase_div_pi);
-	boost::simd::aligned_store(RealSimd(amplitude) * result, real());
+	boost::simd::aligned_store(RealSimd(amplitude) * nco.Cos(), real());
 }
 ///\endcond
 
@@ -156,7 +148,7 @@ inline void FrequencyGenerator<Real>::CalculateOutput()
 template<>
 inline void FrequencyGenerator<Complex>::CalculateOutput()
 {
-	auto result = boost::simd::sincospi(phase_div_pi);
+	auto result = nco.SinCos();
 	boost::simd::aligned_store(RealSimd(amplitude) * result.second, real());
 	boost::simd::aligned_store(RealSimd(amplitude) * result.first , imag());
 }
@@ -2,9 +2,10 @@
 #define FILTER_FREQUENCY_MODULATOR_H_
 
 #include <filter/filter.h>
+#include <filter/nco.h>
 #include <types.h>
+#include <boost/simd/function/aligned_load.hpp>
 #include <boost/simd/function/aligned_store.hpp>
-#include <boost/simd/trigonometric.hpp>
 
 
 /**\ingroup group_filters
@@ -25,8 +26,10 @@ public:
 	 * \param frequency The frequency of the carrier wave. This defaults to 0Hz.
 	 * \param bandwidth The bandwidth of the signal ass uming the input is in the range `[-1, 1]`. This defaults to 1Hz.
 	 * \param amplitude The amplitude of the carrier wave. This defaults to 1.
+	 * \param mode The way the carrier wave is calculated. This defaults to \ref NCO_SINCOSPI.
+	 *             The frequency varies with the input, so \ref NCO_ROTATOR falls back to \ref NCO_TABLE.
 	 */
-	FrequencyModulator(double sample_rate, Real frequency = Real(0), Real bandwidth = Real(1), Real amplitude = Real(1));
+	FrequencyModulator(double sample_rate, Real frequency = Real(0), Real bandwidth = Real(1), Real amplitude = Real(1), NcoMode mode = NCO_SINCOSPI);
 
 
 	/**
@@ -66,13 +69,7 @@ private:
 	const Real bandwidth;	///< The bandwidth of the signal.
 	const Real amplitude;	///< The amplitude of the carrier wave.
 
-	RealSimd phase_div_pi;
-	Real next_phase_div_pi_0 = 0;
-
-	/**
-	 * \brief Initialize the \ref phase_div_pi register.
-	 */
-	void InitPhase();
+	Nco nco;				///< The oscillator keeping track of the phase of the carrier wave.
 
 	/**
 	 * \brief Update the phase based on the current input.
@@ -120,14 +117,10 @@ inline Real FrequencyModulator<Tout>::Amplitude() const
 template<typename Tout>
 inline void FrequencyModulator<Tout>::UpdatePhase()
 {
-	auto in = GetRealInput(0);
-	phase_div_pi[0] = next_phase_div_pi_0;
-	for (int i = 1; i < RealSimd::static_size; ++i)
-		phase_div_pi[i] = phase_div_pi[i - 1] + (frequency + in[i - 1] * bandwidth * DeltatimeOut());
-	next_phase_div_pi_0 = phase_div_pi[RealSimd::static_size - 1] + (frequency + in[RealSimd::static_size - 1] * bandwidth * DeltatimeOut());
-	//Subtract 2 (period of boost::simd::sincospi) as soon as the first value is bigger than 1
-	if (phase_div_pi[0] > 1)
-		phase_div_pi -= RealSimd(2);
+	const RealSimd in = boost::simd::aligned_load<RealSimd>(GetRealInput(0));
+	const RealSimd carrier(static_cast<Real>(frequency * DeltatimeOut()));
+	const RealSimd deviation(static_cast<Real>(bandwidth * DeltatimeOut() / 2));
+	nco.Advance(carrier + in * deviation);
 }
 
 
@@ -135,8 +128,7 @@ inline void FrequencyModulator<Tout>::UpdatePhase()
 template<>
 inline void FrequencyModulator<Real>::CalculateOutput()
 {
-	auto result = boost::simd::cospi(phase_div_pi);
-	boost::simd::aligned_store(RealSimd(amplitude) * result, real());
+	boost::simd::aligned_store(RealSimd(amplitude) * nco.Cos(), real());
 }
 ///\endcond
 
@@ -145,7 +137,7 @@ inline void FrequencyModulator<Real>::CalculateOutput()
 template<>
 inline void FrequencyModulator<Complex>::CalculateOutput()
 {
-	auto result = boost::simd::sincospi(phase_div_pi);
+	auto result = nco.SinCos();
 	boost::simd::aligned_store(RealSimd(amplitude) * result.second, real());
 	boost::simd::aligned_store(RealSimd(amplitude) * result.first, imag());
 }
@@ -2,7 +2,7 @@
 #define FILTER_FREQUENCY_SHIFT_H_
 
 #include <filter/filter.h>
-#include <boost/simd/trigonometric.hpp>
+#include <filter/nco.h>
 #include <boost/simd/function/aligned_store.hpp>
 
 
@@ -21,8 +21,9 @@ public:
 	 * \brief Constructor
 	 * \param sample_rate The number of samples per second arriving at the input of this filter
 	 * \param shift The number of Hertz to shift the frequency spectrum
+	 * \param mode The way the oscillator calculates the complex exponential. This defaults to \ref NCO_SINCOSPI
 	 */
-	FrequencyShift(double sample_rate, Real shift);
+	FrequencyShift(double sample_rate, Real shift, NcoMode mode = NCO_SINCOSPI);
 
 
 	/**
@@ -31,16 +32,10 @@ public:
 	virtual void Update();
 
 private:
-	const Real deltaphase_div_pi;	///< The phase difference between two samples divided by pi
-	RealSimd phase_div_pi;			///< The current phase divided by pi
+	Nco nco;	///< The oscillator generating the complex exponential
 
 	/**
-	 * \brief initialize the phase SIMD register
-	 */
-	void initPhase();
-
-	/**
-	 * \brief Update the phase and keep it in a range as close to 0 as possible to maximize accuracy
+	 * \brief Update the phase of the complex exponential
 	 */
 	void UpdatePhase();
 
@@ -56,16 +51,14 @@ private:
 template<typename Tin>
 inline void FrequencyShift<Tin>::UpdatePhase()
 {
-	phase_div_pi += RealSimd(RealSimd::static_size * deltaphase_div_pi);
-	if (phase_div_pi[RealSimd::static_size / 2] > 2 || phase_div_pi[RealSimd::static_size / 2] < 2)
-		phase_div_pi -= RealSimd(2 * ((int)phase_div_pi[RealSimd::static_size/2] / 2));
+	nco.Advance();
 }
 
 
 template<>
 inline void FrequencyShift<Real>::CalculateOutput()
 {
-	auto exp = boost::simd::sincospi(phase_div_pi);
+	auto exp = nco.SinCos();
 	auto input = boost::simd::aligned_load<RealSimd>(GetRealInput(0));
 	boost::simd::aligned_store(exp.second * input, real());
 	boost::simd::aligned_store(exp.first * input, imag());
@@ -75,7 +68,7 @@ inline void FrequencyShift<Real>::CalculateOutput()
 template<>
 inline void FrequencyShift<Complex>::CalculateOutput()
 {
-	auto exp = boost::simd::sincospi(phase_div_pi);
+	auto exp = nco.SinCos();
 	auto in = GetComplexInput(0);
 	auto re = boost::simd::aligned_load<RealSimd>(in.first);
 	auto im = boost::simd::aligned_load<RealSimd>(in.second);
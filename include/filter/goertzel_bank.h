@@ -0,0 +1,111 @@
+#ifndef FILTER_GOERTZEL_BANK_H_
+#define FILTER_GOERTZEL_BANK_H_
+
+#include <filter/filter.h>
+#include <types.h>
+#include <cstdint>
+#include <vector>
+
+
+/**\ingroup group_filters
+ * \brief Measure the power of the input signal at a few frequencies with the Goertzel algorithm.
+ *
+ * The recursions of \ref RealSimd::static_size frequencies are calculated at once, one in every element of a SIMD register.
+ * After every `block_length` input samples, the power of every frequency in the last block becomes available through
+ * \ref Powers() and \ref PowersReady() returns `true` until the next call to \ref Update().
+ * The power is the squared magnitude of the DFT of the block at that frequency, divided by `block_length^2`.
+ * So a complex exponential with amplitude `A` at one of the frequencies has a power of `A^2`,
+ * and a cosine with amplitude `A` has a power of `A^2/4`.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class GoertzelBank : public Filter
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param frequencies The frequencies to measure the power at.
+	 * \param block_length The number of samples per measurement. Has to be a multiple of \ref RealSimd::static_size.
+	 */
+	GoertzelBank(double sample_rate, const std::vector<Real>& frequencies, uint32_t block_length);
+
+
+	/**
+	 * \brief Update this filter.
+	 */
+	virtual void Update();
+
+
+	/**
+	 * \brief Check if the last call to \ref Update() completed a measurement.
+	 * \returns `true` if there are new powers.
+	 */
+	bool PowersReady() const;
+
+	/**
+	 * \brief Get the powers of the last block.
+	 * \returns A pointer to one power per frequency, in the order the frequencies were passed to the constructor.
+	 */
+	const Real* Powers() const;
+
+	/**
+	 * \brief Get the frequencies this filter measures.
+	 * \returns The frequencies passed to the constructor.
+	 */
+	const std::vector<Real>& Frequencies() const;
+
+private:
+	const std::vector<Real> frequencies;	///< The frequencies to measure the power at
+	const uint32_t block_length;			///< The number of samples per measurement
+
+	//All of the following vectors are padded to a whole number of SIMD registers
+	AlignedStdVec<Real> coefficients;	///< `2*cos(w)` for every frequency, where `w` is the frequency in radians per sample
+	AlignedStdVec<Real> cosines;		///< `cos(w)` for every frequency
+	AlignedStdVec<Real> sines;			///< `sin(w)` for every frequency
+	AlignedStdVec<Real> state_real;		///< The last two values of the recursion of the real part, one register of frequencies after the other
+	AlignedStdVec<Real> state_imag;		///< The last two values of the recursion of the imaginary part
+	AlignedStdVec<Real> powers;			///< The powers of the last block
+
+	uint32_t sample_count = 0;		///< The number of samples in the current block
+	bool powers_ready = false;		///< Wether the last update completed a measurement
+
+	/**
+	 * \brief Run the recursion over one block of input samples.
+	 * \param in The block of input samples.
+	 * \param state The states of the recursion.
+	 */
+	void Recurse(const Real* in, Real* state) const;
+
+	/**
+	 * \brief Calculate the powers from the states and reset them.
+	 */
+	void Finish();
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline bool GoertzelBank<Tin>::PowersReady() const
+{
+	return powers_ready;
+}
+
+
+template<typename Tin>
+inline const Real* GoertzelBank<Tin>::Powers() const
+{
+	return powers.data();
+}
+
+
+template<typename Tin>
+inline const std::vector<Real>& GoertzelBank<Tin>::Frequencies() const
+{
+	return frequencies;
+}
+
+
+#endif //FILTER_GOERTZEL_BANK_H_
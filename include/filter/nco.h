@@ -0,0 +1,244 @@
+#ifndef FILTER_NCO_H_
+#define FILTER_NCO_H_
+
+#include <types.h>
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <boost/simd/pack.hpp>
+#include <boost/simd/trigonometric.hpp>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/simd/function/round.hpp>
+#include <boost/simd/function/slide.hpp>
+
+
+/**
+ * \file filter/nco.h
+ * \brief A numerically controlled oscillator shared by all filters generating sinusodial signals.
+ */
+
+
+/**
+ * \brief The way a \ref Nco calculates its sine and cosine values.
+ */
+enum NcoMode {
+	NCO_SINCOSPI,	///< Evaluate `boost::simd::sincospi` for every sample. This is the most accurate and the slowest mode.
+	NCO_TABLE,		///< Look the values up in a sine table with linear interpolation. The error is below `3e-7`.
+	NCO_ROTATOR		///< Rotate a complex phasor by a constant angle every update. Only supported for constant frequencies.
+};
+
+
+/**
+ * \brief The base 2 logarithm of the number of entries in the sine table used in \ref NCO_TABLE mode.
+ */
+constexpr int NCO_TABLE_BITS = 12;
+
+/**
+ * \brief The number of updates after which the phasor of a \ref NCO_ROTATOR is recalculated from the exact phase.
+ */
+constexpr uint32_t NCO_ROTATOR_RENORMALIZATION_INTERVAL = 64;
+
+
+/**
+ * \brief Calculate the inclusive prefix sum of the elements of a SIMD Register.
+ *
+ * The sum is calculated in `log2(RealSimd::static_size)` steps, each adding a shifted copy of the register.
+ *
+ * \param x The values to sum up.
+ * \returns A register where element `i` is the sum of the elements `0` to `i` of `x`.
+ */
+RealSimd PrefixSum(const RealSimd& x);
+
+
+/**
+ * \brief A numerically controlled oscillator.
+ *
+ * The phase of the oscillator is kept in a 64 bit integer accumulator, where `2^64` corresponds to one full period.
+ * The phase therefore wraps around for free and never looses precision, no matter how long the oscillator runs.
+ * Every update generates the next \ref RealSimd::static_size samples.
+ */
+class Nco
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param cycles_per_sample The frequency of the oscillator divided by the sample rate.
+	 * \param phaseshift The phase of the first sample in the interval `[0, 2pi)`.
+	 * \param mode The way the sine and cosine values are calculated.
+	 */
+	Nco(double cycles_per_sample, Real phaseshift, NcoMode mode = NCO_SINCOSPI);
+
+
+	/**
+	 * \brief Advance the phase to the next \ref RealSimd::static_size samples using the constant frequency.
+	 */
+	void Advance();
+
+	/**
+	 * \brief Advance the phase to the next \ref RealSimd::static_size samples using a frequency for every sample.
+	 *
+	 * The phase of a sample is the phase of the previous sample plus the frequency of the previous sample.
+	 * The phases are integrated with a vectorized prefix sum instead of a serial loop.
+	 * This can not be used in \ref NCO_ROTATOR mode.
+	 *
+	 * \param cycles_per_sample The frequencies of the samples divided by the sample rate.
+	 */
+	void Advance(const RealSimd& cycles_per_sample);
+
+
+	/**
+	 * \brief Get the cosine of the current phases.
+	 * \returns The cosine of the current phases.
+	 */
+	RealSimd Cos() const;
+
+	/**
+	 * \brief Get the sine and the cosine of the current phases.
+	 * \returns A pair with `first` storing the sine and `second` storing the cosine of the current phases.
+	 */
+	std::pair<RealSimd, RealSimd> SinCos() const;
+
+
+	/**
+	 * \brief Get the mode of this oscillator.
+	 * \returns The way this oscillator calculates its values.
+	 */
+	NcoMode Mode() const;
+
+
+	/**
+	 * \brief Convert a phase in periods to the phase of the accumulator.
+	 * \param cycles The phase in periods.
+	 * \returns The phase as an integer, where `2^64` is one period.
+	 */
+	static uint64_t CyclesToPhase(double cycles);
+
+private:
+	using PhaseArray = std::array<uint64_t, RealSimd::static_size>;
+
+	const NcoMode mode;		///< The way the sine and cosine values are calculated
+	uint64_t increment;		///< The constant phase increment per sample
+	PhaseArray phase;		///< The phase of every sample of the current update
+	uint64_t next_phase;	///< The phase of the first sample of the next update
+
+	RealSimd rotator_real;		///< The real part of the phasor of every sample in \ref NCO_ROTATOR mode
+	RealSimd rotator_imag;		///< The imaginary part of the phasor of every sample in \ref NCO_ROTATOR mode
+	Real step_real;				///< The real part of the rotation applied every update
+	Real step_imag;				///< The imaginary part of the rotation applied every update
+	uint32_t steps_since_renormalization = 0;
+
+
+	/**
+	 * \brief Get the current phases divided by `pi`.
+	 * \returns The current phases divided by `pi` in the interval `[0, 2)`.
+	 */
+	RealSimd PhaseDivPi() const;
+
+	/**
+	 * \brief Look up the sine of some phases in the sine table.
+	 * \param phases The phases to look up.
+	 * \param offset An offset added to every phase. `2^62` turns the sine into a cosine.
+	 * \returns The sine of the phases.
+	 */
+	static RealSimd TableLookup(const PhaseArray& phases, uint64_t offset);
+
+	/**
+	 * \brief Recalculate the phasor of a \ref NCO_ROTATOR from the exact phase.
+	 */
+	void RenormalizeRotator();
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+///\cond IMPLEMENTATION_DETAILS
+template<int Shift>
+struct prefix_sum_impl
+{
+	static RealSimd Apply(const RealSimd& x)
+	{
+		//Shift the elements by `Shift` positions towards the end, filling in zeros at the front
+		return prefix_sum_impl<2 * Shift>::Apply(x + boost::simd::slide<RealSimd::static_size - Shift>(RealSimd(0), x));
+	}
+};
+
+template<>
+struct prefix_sum_impl<RealSimd::static_size>
+{
+	static RealSimd Apply(const RealSimd& x)
+	{
+		return x;
+	}
+};
+///\endcond
+
+
+inline RealSimd PrefixSum(const RealSimd& x)
+{
+	return prefix_sum_impl<1>::Apply(x);
+}
+
+
+inline NcoMode Nco::Mode() const
+{
+	return mode;
+}
+
+
+inline RealSimd Nco::PhaseDivPi() const
+{
+	alignas(RealSimd::alignment) Real phase_div_pi[RealSimd::static_size];
+	for (size_t i = 0; i < RealSimd::static_size; ++i)
+		phase_div_pi[i] = static_cast<Real>(phase[i] * (1.0 / 9223372036854775808.0));	// 2^63 is half a period
+	return boost::simd::aligned_load<RealSimd>(phase_div_pi);
+}
+
+
+inline void Nco::Advance()
+{
+	const uint64_t step = increment * RealSimd::static_size;
+	for (uint64_t& p : phase)
+		p += step;
+	next_phase += step;
+	if (mode == NCO_ROTATOR) {
+		if (++steps_since_renormalization == NCO_ROTATOR_RENORMALIZATION_INTERVAL)
+			RenormalizeRotator();
+		else {
+			const RealSimd re = rotator_real * RealSimd(step_real) - rotator_imag * RealSimd(step_imag);
+			rotator_imag = rotator_real * RealSimd(step_imag) + rotator_imag * RealSimd(step_real);
+			rotator_real = re;
+		}
+	}
+}
+
+
+inline RealSimd Nco::Cos() const
+{
+	switch (mode) {
+	case NCO_TABLE:
+		return TableLookup(phase, uint64_t(1) << 62);
+	case NCO_ROTATOR:
+		return rotator_real;
+	default:
+		return boost::simd::cospi(PhaseDivPi());
+	}
+}
+
+
+inline std::pair<RealSimd, RealSimd> Nco::SinCos() const
+{
+	switch (mode) {
+	case NCO_TABLE:
+		return std::pair<RealSimd, RealSimd>(TableLookup(phase, 0), TableLookup(phase, uint64_t(1) << 62));
+	case NCO_ROTATOR:
+		return std::pair<RealSimd, RealSimd>(rotator_imag, rotator_real);
+	default: {
+		auto result = boost::simd::sincospi(PhaseDivPi());
+		return std::pair<RealSimd, RealSimd>(result.first, result.second);
+	}
+	}
+}
+
+
+#endif //FILTER_NCO_H_
\ No newline at end of file
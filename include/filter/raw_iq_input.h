@@ -0,0 +1,111 @@
+#ifndef FILTER_RAW_IQ_INPUT_H_
+#define FILTER_RAW_IQ_INPUT_H_
+
+#include <io/input_file.h>
+#include <io/raw_iq.h>
+#include <io/sample_conversion.h>
+#include <filter/filter.h>
+#include <types.h>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+
+/**\ingroup group_filters
+ * \brief Reads the samples of a raw IQ file and provides them as input to other filters.
+ *
+ * Raw IQ files are the sample dumps of SDR tools without any header. The I and Q samples alternate and become
+ * the real and imaginary part of the \ref Complex output. Every update reads a whole block of samples through an
+ * \ref InputFile and converts them to `[-1, 1]`, splitting I and Q in the same pass. The DC offset of
+ * \ref RAW_IQ_CU8 samples is removed in the conversion. After the end of the file, the output is 0.
+ * The samples can also be streamed from a file descriptor, e.g. the standard input at the end of a pipe from `rtl_sdr -`.
+ *
+ * \tparam Tout The type of output this filter provides. Has to be \ref Complex.
+ */
+template<typename Tout>
+class RawIqInput : public Filter
+{
+	static_assert(std::is_same<Tout, Complex>::value, "RawIqInput provides a Complex output signal!");
+
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second in the file.
+	 * \param path The path to the raw IQ file.
+	 * \param format The format of the samples in the file.
+	 * \param mode The way the samples are read from the file. \ref FILE_READ_MAPPED avoids copying the data,
+	 *             \ref FILE_READ_ASYNC reads ahead on a background thread. This defaults to \ref FILE_READ_STREAM.
+	 * \throws std::runtime_error If the file can't be opened.
+	 */
+	RawIqInput(double sample_rate, const std::string& path, RawIqFormat format, FileReadMode mode = FILE_READ_STREAM);
+
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second in the stream.
+	 * \param descriptor The file descriptor to stream the samples from, e.g. \ref StandardInput. It is not closed by this filter.
+	 * \param format The format of the samples in the stream.
+	 * \param mode The way the samples are read. \ref FILE_READ_ASYNC reads ahead on a background thread, so the writing
+	 *             process doesn't have to wait. This defaults to \ref FILE_READ_STREAM.
+	 */
+	RawIqInput(double sample_rate, int descriptor, RawIqFormat format, FileReadMode mode = FILE_READ_STREAM);
+
+
+	/**
+	 * \brief Update the output of this filter.
+	 */
+	virtual void Update();
+
+
+	/**
+	 * \brief Get the format of the samples.
+	 * \returns The format of the samples in the file.
+	 */
+	RawIqFormat Format() const;
+
+	/**
+	 * \brief Get the length of the file.
+	 * \returns The number of complex samples in the file. The length of a stream from a file descriptor is unknown,
+	 *          so it is the largest `uint64_t` divided by the size of a sample.
+	 */
+	uint64_t SampleCount() const;
+
+	/**
+	 * \brief Check if the end of the file is reached.
+	 * \returns `true` if all samples of the file have been put out.
+	 */
+	bool EndOfFile() const;
+
+private:
+	InputFile file;						///< The file to read the samples from
+	const RawIqFormat format;			///< The format of the samples in the file
+	const size_t frame_size;			///< The number of bytes of a complex sample
+	DeinterleaveFunction deinterleave;	///< The conversion of the samples in the file
+	const Real scale;					///< The factor to convert the samples to `[-1, 1]`
+	bool end_of_file = false;			///< Wether an update read less than a block, which is the only way to notice the end of a stream
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tout>
+inline RawIqFormat RawIqInput<Tout>::Format() const
+{
+	return format;
+}
+
+
+template<typename Tout>
+inline uint64_t RawIqInput<Tout>::SampleCount() const
+{
+	return file.Length() / frame_size;
+}
+
+
+template<typename Tout>
+inline bool RawIqInput<Tout>::EndOfFile() const
+{
+	return end_of_file || file.Position() / frame_size >= SampleCount();
+}
+
+
+#endif //FILTER_RAW_IQ_INPUT_H_
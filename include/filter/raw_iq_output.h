@@ -0,0 +1,98 @@
+#ifndef FILTER_RAW_IQ_OUTPUT_H_
+#define FILTER_RAW_IQ_OUTPUT_H_
+
+#include <io/output_file.h>
+#include <io/raw_iq.h>
+#include <io/sample_conversion.h>
+#include <filter/filter.h>
+#include <types.h>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+
+/**\ingroup group_filters
+ * \brief Writes the input signal to a raw IQ file.
+ *
+ * The real and imaginary part of the \ref Complex input become the interleaved I and Q samples of the file,
+ * which has no header, so it can be read by SDR tools. Every update converts a whole block of samples and
+ * appends them to the buffer of an \ref OutputFile. Integer samples are rounded, and values outside of `[-1, 1]`
+ * are saturated instead of letting them wrap around.
+ * The samples can also be streamed to a file descriptor, e.g. the standard output at the start of a pipe.
+ *
+ * \tparam Tin The type of input this filter accepts. Has to be \ref Complex.
+ */
+template<typename Tin>
+class RawIqOutput : public Filter
+{
+	static_assert(std::is_same<Tin, Complex>::value, "RawIqOutput needs a Complex input signal!");
+
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param path The path to the raw IQ file to write.
+	 * \param format The format of the samples in the file.
+	 * \param dampening_factor A constant factor to multiply the input signal with. This defaults to 1.
+	 * \param mode The way the data is written to the file. With \ref FILE_WRITE_ASYNC, the file is written on a background thread.
+	 *             This defaults to \ref FILE_WRITE_BUFFERED.
+	 */
+	RawIqOutput(double sample_rate, const std::string& path, RawIqFormat format, Real dampening_factor = 1, FileWriteMode mode = FILE_WRITE_BUFFERED);
+
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param descriptor The file descriptor to stream the samples to, e.g. \ref StandardOutput. It is not closed by this filter.
+	 * \param format The format of the samples in the stream.
+	 * \param dampening_factor A constant factor to multiply the input signal with. This defaults to 1.
+	 * \param mode The way the data is written. With \ref FILE_WRITE_ASYNC, a slow reader at the other end of a pipe
+	 *             doesn't hold up the updates. This defaults to \ref FILE_WRITE_BUFFERED.
+	 */
+	RawIqOutput(double sample_rate, int descriptor, RawIqFormat format, Real dampening_factor = 1, FileWriteMode mode = FILE_WRITE_BUFFERED);
+
+
+	/**
+	 * \brief Update the output file.
+	 */
+	virtual void Update();
+
+
+	/**
+	 * \brief Write the buffered samples and close the file.
+	 *
+	 * A file descriptor stays open, but no more samples are written to it.
+	 */
+	void Close();
+
+	/**
+	 * \brief Get the format of the samples.
+	 * \returns The format of the samples in the file.
+	 */
+	RawIqFormat Format() const;
+
+private:
+	OutputFile file;				///< The file to write the samples to
+	const RawIqFormat format;		///< The format of the samples in the file
+	const size_t frame_size;		///< The number of bytes of a complex sample
+	InterleaveFunction interleave;	///< The conversion to the samples in the file
+	const Real scale;				///< The factor to convert the input to the samples in the file
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline void RawIqOutput<Tin>::Close()
+{
+	file.Close();
+}
+
+
+template<typename Tin>
+inline RawIqFormat RawIqOutput<Tin>::Format() const
+{
+	return format;
+}
+
+
+#endif //FILTER_RAW_IQ_OUTPUT_H_
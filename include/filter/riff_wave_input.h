@@ -2,8 +2,11 @@
 #define FILTER_RIFF_WAVE_INPUT_H_
 
 #include <io/riff_wave.h>
+#include <io/sample_conversion.h>
 #include <filter/filter.h>
 #include <string>
+#include <vector>
+#include <cstdint>
 
 
 /**\ingroup group_filters
@@ -11,6 +14,11 @@
  *
  * If `Tout` is defined to be \ref Real, the filter will provide an output for every channel.
  * If `Tout` is defined to be \ref Complex, the filter will take two channels and combine them to one \ref Complex output.
+ * Every update reads a whole block of frames at once and converts them directly into the outputs,
+ * splitting the channels in the same pass. After the end of the file, the outputs are 0.
+ * To process only a part of the file, move to its first frame with \ref seekFrame() before the first update.
+ * The WAVE data can also be streamed from a file descriptor, e.g. the standard input at the end of a pipe.
+ * Integer samples with 8, 16, 24 or 32 bits are scaled to `[-1, 1]`, floating point samples with 32 or 64 bits are passed on as they are.
  *
  * \tparam Tout The type of output this filter provides. Either has to be \ref Real or \ref Complex.
  */
@@ -20,8 +28,23 @@ class RiffWaveInput : public RIFFWaveIStream, public Filter	//This inheritance o
 public:
 	/**
 	 * \brief Constructor
+	 * \param path The path to the WAVE file.
+	 * \param mode The way the samples are read from the file. \ref FILE_READ_MAPPED avoids copying the data,
+	 *             which makes a difference for large recordings. \ref FILE_READ_ASYNC reads ahead on a background thread.
+	 *             This defaults to \ref FILE_READ_STREAM.
+	 * \throws std::runtime_error If the file can't be opened.
+	 * \throws std::invalid_argument If the file is no valid WAVE file or has a sample format or bit depth that can't be read.
 	 */
-	RiffWaveInput(const std::string& path);
+	RiffWaveInput(const std::string& path, FileReadMode mode = FILE_READ_STREAM);
+
+	/**
+	 * \brief Constructor
+	 * \param descriptor The file descriptor to stream the WAVE data from, e.g. \ref StandardInput. It is not closed by this filter.
+	 * \param mode The way the samples are read. \ref FILE_READ_ASYNC reads ahead on a background thread, so the writing
+	 *             process doesn't have to wait. This defaults to \ref FILE_READ_STREAM.
+	 * \throws std::invalid_argument If the file is no valid WAVE file or has a sample format or bit depth that can't be read.
+	 */
+	RiffWaveInput(int descriptor, FileReadMode mode = FILE_READ_STREAM);
 
 
 	/**
@@ -30,8 +53,16 @@ public:
 	virtual void Update();
 
 private:
+	std::vector<Real*> channels;	///< The output array of every channel in the file. For \ref Complex outputs, the real and imaginary parts alternate.
 
+	DeinterleaveFunction deinterleave;	///< The conversion of the samples in the file
+	Real scale;		///< The factor to convert the samples to `[-1, 1]`
+
+	/**
+	 * \brief Add the outputs for the channels of the file.
+	 */
+	void AddChannels();
 };
 
 
-#endif //FILTER_RIFF_WAVE_INPUT_H_
\ No newline at end of file
+#endif //FILTER_RIFF_WAVE_INPUT_H_
@@ -14,6 +14,9 @@
  * If the filter is configured to take a real input, the input corresponds to one channel in the WAV file.
  * If it is configured to take a complex input, the input corresponds to two channels with the first
  * one representing the real and the second one representing the imaginary part.
+ * Every update rounds a whole block of samples to integers, saturating values outside of `[-1, 1]`
+ * instead of letting them wrap around, and appends them to the buffer of the file.
+ * The WAVE data can also be streamed to a file descriptor, e.g. the standard output at the start of a pipe.
  *
  * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
  */
@@ -26,8 +29,20 @@ public:
 	 * \param sample_rate The number of samples per second at the input to this filter.
 	 * \param path The path for the WAV file to be written to.
 	 * \param dampening_factor A constant factor to multiply the input signal with. This defaults to 1.
+	 * \param mode The way the data is written to the file. With \ref FILE_WRITE_ASYNC, the file is written on a background thread.
+	 *             This defaults to \ref FILE_WRITE_BUFFERED.
 	 */
-	RiffWaveOutput(uint32_t sample_rate, const std::string& path, Real dampening_factor = 1);
+	RiffWaveOutput(uint32_t sample_rate, const std::string& path, Real dampening_factor = 1, FileWriteMode mode = FILE_WRITE_BUFFERED);
+
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input to this filter.
+	 * \param descriptor The file descriptor to stream the WAVE data to, e.g. \ref StandardOutput. It is not closed by this filter.
+	 * \param dampening_factor A constant factor to multiply the input signal with. This defaults to 1.
+	 * \param mode The way the data is written. With \ref FILE_WRITE_ASYNC, a slow reader at the other end of a pipe
+	 *             doesn't hold up the updates. This defaults to \ref FILE_WRITE_BUFFERED.
+	 */
+	RiffWaveOutput(uint32_t sample_rate, int descriptor, Real dampening_factor = 1, FileWriteMode mode = FILE_WRITE_BUFFERED);
 
 
 	/**
@@ -37,6 +52,12 @@ public:
 
 private:
 	Real dampening_factor;	///< The incoming signal is multiplied by this factor before it is written to the file.
+
+	/**
+	 * \brief Append one block of samples to the file.
+	 * \param channels The block of every channel of the file.
+	 */
+	void Write(const Real* const* channels);
 };
 
 
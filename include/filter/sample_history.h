@@ -0,0 +1,76 @@
+#ifndef FILTER_SAMPLE_HISTORY_H_
+#define FILTER_SAMPLE_HISTORY_H_
+
+#include <types.h>
+#include <cstddef>
+
+
+/**
+ * \file filter/sample_history.h
+ * \brief A linear buffer of the most recent samples of a signal.
+ */
+
+
+/**
+ * \brief A sliding window over the most recent samples of a signal.
+ *
+ * Filters that look at more than the current block of samples (e.g. FIR filters or correlators)
+ * need the samples of the window in contiguous memory, so they can be loaded into SIMD Registers
+ * at any offset. A circular buffer would split the window at its wrap around point.
+ * Instead, this buffer reserves some space behind the window and appends new blocks there.
+ * Only when the end of the buffer is reached, the window is moved back to the front,
+ * so on average much less than one sample is copied per new sample.
+ * The window initially contains zeros.
+ */
+class SampleHistory
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param window_size The number of most recent samples accessible through \ref Data().
+	 *                    This has to be at least \ref RealSimd::static_size.
+	 */
+	SampleHistory(size_t window_size);
+
+
+	/**
+	 * \brief Append a block of \ref RealSimd::static_size samples to the window and discard the oldest ones.
+	 * \param block A pointer to \ref RealSimd::static_size samples.
+	 */
+	void Push(const Real* block);
+
+
+	/**
+	 * \brief Get the samples in the window.
+	 * \returns A pointer to the oldest sample in the window. The newest sample is at `Data()[WindowSize() - 1]`.
+	 */
+	const Real* Data() const;
+
+	/**
+	 * \brief Get the size of the window.
+	 * \returns The number of samples accessible through \ref Data().
+	 */
+	size_t WindowSize() const;
+
+private:
+	const size_t window_size;	///< The number of samples in the window
+	AlignedStdVec<Real> buffer;	///< The window and the space reserved for upcoming blocks
+	size_t begin = 0;			///< The index of the oldest sample of the window in \ref buffer
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+inline const Real* SampleHistory::Data() const
+{
+	return buffer.data() + begin;
+}
+
+
+inline size_t SampleHistory::WindowSize() const
+{
+	return window_size;
+}
+
+
+#endif //FILTER_SAMPLE_HISTORY_H_
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef FILTER_SHM_RING_INPUT_H_
+#define FILTER_SHM_RING_INPUT_H_
+
+#include <io/shm_ring.h>
+#include <filter/filter.h>
+#include <types.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/**\ingroup group_filters
+ * \brief Receives the samples of another process through a \ref ShmRing in shared memory.
+ *
+ * The counterpart of a \ref ShmRingOutput in the other process, which has to use the same name, type and number of blocks.
+ * The ring carries the blocks of samples in the layout of the filter outputs, so every update copies one aligned
+ * SIMD register per channel straight into the outputs. An update waits until the other process provided the samples.
+ * After the other process closed the ring, the output is 0.
+ *
+ * \tparam Tout The type of output this filter provides. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tout>
+class ShmRingInput : public Filter
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second this filter outputs.
+	 * \param name The name of the shared memory. It must not contain any slashes.
+	 * \param block_count The number of blocks of the ring, each holding \ref ShmRingSampleBlocks blocks of samples. This defaults to 16.
+	 */
+	ShmRingInput(double sample_rate, const std::string& name, size_t block_count = 16);
+
+
+	/**
+	 * \brief Update the output of this filter.
+	 */
+	virtual void Update();
+
+
+	/**
+	 * \brief Check if the end of the stream is reached.
+	 * \returns `true` if the other process closed the ring and all of its samples have been put out.
+	 */
+	bool EndOfStream() const;
+
+private:
+	std::vector<Real*> channels;	///< The output arrays, for \ref Complex outputs the real and the imaginary part
+	ShmRing ring;					///< The ring shared with the other process
+	const uint8_t* block = nullptr;	///< The block taken from the ring, if any
+	size_t block_size = 0;			///< The number of bytes in \ref block
+	size_t position = 0;			///< The position of the next samples in \ref block
+	bool end_of_stream = false;		///< Wether the other process closed the ring
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tout>
+inline bool ShmRingInput<Tout>::EndOfStream() const
+{
+	return end_of_stream;
+}
+
+
+#endif //FILTER_SHM_RING_INPUT_H_
@@ -0,0 +1,65 @@
+#ifndef FILTER_SHM_RING_OUTPUT_H_
+#define FILTER_SHM_RING_OUTPUT_H_
+
+#include <io/shm_ring.h>
+#include <filter/filter.h>
+#include <types.h>
+#include <cstdint>
+#include <string>
+
+
+/**\ingroup group_filters
+ * \brief Passes the input signal to another process through a \ref ShmRing in shared memory.
+ *
+ * The counterpart of a \ref ShmRingInput in the other process, which has to use the same name, type and number of blocks.
+ * Every update copies one aligned SIMD register per channel into the ring, a block of the ring is handed over once
+ * it holds \ref ShmRingSampleBlocks blocks of samples. An update only waits if the other process falls behind by the
+ * whole ring. If the other process closed the ring, the input is dropped.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class ShmRingOutput : public Filter
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param name The name of the shared memory. It must not contain any slashes.
+	 * \param block_count The number of blocks of the ring, each holding \ref ShmRingSampleBlocks blocks of samples. This defaults to 16.
+	 */
+	ShmRingOutput(double sample_rate, const std::string& name, size_t block_count = 16);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Calls \ref Close().
+	 */
+	virtual ~ShmRingOutput();
+
+
+	/**
+	 * \brief Update this filter.
+	 */
+	virtual void Update();
+
+
+	/**
+	 * \brief Hand over the samples of the current block and end the stream.
+	 */
+	void Close();
+
+private:
+	ShmRing ring;				///< The ring shared with the other process
+	uint8_t* block = nullptr;	///< The block taken from the ring, if any
+	size_t position = 0;		///< The position of the next samples in \ref block
+
+	/**
+	 * \brief Copy one block of samples into the ring.
+	 * \param channels The block of every channel, for \ref Complex inputs the real and the imaginary part.
+	 */
+	void Write(const Real* const* channels);
+};
+
+
+#endif //FILTER_SHM_RING_OUTPUT_H_
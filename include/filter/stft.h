@@ -0,0 +1,135 @@
+#ifndef FILTER_STFT_H_
+#define FILTER_STFT_H_
+
+#include <filter/filter.h>
+#include <filter/fft.h>
+#include <filter/sample_history.h>
+#include <filter/window_functions.h>
+#include <types.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+
+/**\ingroup group_filters
+ * \brief Calculate the short time fourier transform of the input signal.
+ *
+ * Every `hop` input samples, the most recent `size` samples are weighed with the window function and
+ * transformed with a \ref FftPlan. The frames do not fit into the blocks of \ref RealSimd::static_size
+ * samples passed between filters, so they are provided through \ref FrameReal() and \ref FrameImag()
+ * instead. Like the output of a \ref Decimator, a new frame is available after the calls to \ref Update()
+ * for which \ref FrameReady() returns `true`. The frame rate is the output sample rate of this filter.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class Stft : public Filter
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param size The number of samples per frame. Has to be a power of two.
+	 * \param hop The number of samples between the start of two frames. Has to be a multiple of \ref RealSimd::static_size.
+	 * \param window_function The window function to weigh the samples of a frame with. It is evaluated periodically,
+	 *                        i.e. at `i / size` for the sample `i`. This defaults to \ref Hann.
+	 */
+	Stft(double sample_rate, uint32_t size, uint32_t hop, const std::function<Real(Real)>& window_function = Hann);
+
+
+	/**
+	 * \brief Update this filter.
+	 */
+	virtual void Update();
+
+	/**
+	 * \brief Get the group delay of this filter.
+	 * \returns The time between the center of a frame and the time it is calculated.
+	 */
+	virtual double GroupDelay() const;
+
+
+	/**
+	 * \brief Check if the last call to \ref Update() calculated a new frame.
+	 * \returns `true` if there is a new frame.
+	 */
+	bool FrameReady() const;
+
+	/**
+	 * \brief Get the real part of the last frame.
+	 * \returns A pointer to \ref Size() aligned values. Bin `k` corresponds to the frequency `k * SampleRateIn() / Size()`.
+	 */
+	const Real* FrameReal() const;
+
+	/**
+	 * \brief Get the imaginary part of the last frame.
+	 * \returns A pointer to \ref Size() aligned values.
+	 */
+	const Real* FrameImag() const;
+
+	/**
+	 * \brief Get the number of samples per frame.
+	 * \returns The length of the FFT.
+	 */
+	uint32_t Size() const;
+
+private:
+	std::shared_ptr<const FftPlan> plan;	///< The FFT shared with all other users of the same size
+	AlignedStdVec<Real> window;				///< The window function evaluated at every sample of a frame
+
+	SampleHistory history_real;	///< The most recent samples of the real part of the input
+	SampleHistory history_imag;	///< The most recent samples of the imaginary part of the input
+
+	AlignedStdVec<Real> frame_real;	///< The real part of the last frame
+	AlignedStdVec<Real> frame_imag;	///< The imaginary part of the last frame
+
+	uint32_t block_count = 0;	///< The number of input blocks since the last frame
+	bool frame_ready = false;	///< Wether the last update calculated a frame
+
+	/**
+	 * \brief Weigh the samples in the history with the window.
+	 * \param history The input samples
+	 * \param out The array to store the weighed samples in.
+	 */
+	void Window(const SampleHistory& history, Real* out) const;
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline double Stft<Tin>::GroupDelay() const
+{
+	return Size() / 2.0 * DeltatimeIn();
+}
+
+
+template<typename Tin>
+inline bool Stft<Tin>::FrameReady() const
+{
+	return frame_ready;
+}
+
+
+template<typename Tin>
+inline const Real* Stft<Tin>::FrameReal() const
+{
+	return frame_real.data();
+}
+
+
+template<typename Tin>
+inline const Real* Stft<Tin>::FrameImag() const
+{
+	return frame_imag.data();
+}
+
+
+template<typename Tin>
+inline uint32_t Stft<Tin>::Size() const
+{
+	return static_cast<uint32_t>(plan->Size());
+}
+
+
+#endif //FILTER_STFT_H_
\ No newline at end of file
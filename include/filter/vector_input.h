@@ -3,6 +3,7 @@
 
 #include <types.h>
 #include <filter/filter.h>
+#include <cstddef>
 #include <vector>
 
 
@@ -10,6 +11,10 @@
  * \brief Outputs data stored in a `std::vector`.
  *
  * When the end of the data is reached, the output loops back to the beginning of the data.
+ * Every update copies the samples up to the end of the data as one run, so the wrap around is handled
+ * once per block. \ref Complex samples are split into the real and the imaginary part with the same SIMD
+ * deinterleave as two channel WAVE files. With `split` set, they are split once when the data is set and
+ * every update is a plain copy of both parts.
  *
  * \tparam Tout The type of signal this filter outputs. Either has to be \ref Real or \ref Complex.
  */
@@ -27,21 +32,23 @@ public:
 	 * \brief Constructor
 	 * \param sample_rate The number of samples per second this filters input.
 	 * \param out A vector storing the data to output.
+	 * \param split Wether to store \ref Complex data split into the real and the imaginary part. This defaults to `false`.
 	 */
-	VectorInput(double sample_rate, std::vector<Tout> out);
+	VectorInput(double sample_rate, std::vector<Tout> out, bool split = false);
 
 	/**
 	 * \brief Constructor
 	 * \param sample_rate The number of samples per second at this filters input.
 	 * \param out A vector storing the data to output.
+	 * \param split Wether to store \ref Complex data split into the real and the imaginary part. This defaults to `false`.
 	 */
-	VectorInput(double sample_rate, std::vector<Tout>&& out);
+	VectorInput(double sample_rate, std::vector<Tout>&& out, bool split = false);
 
 
 	/**
 	 * \brief Update the output of this filter.
 	 *
-	 * If the end of the data is reached, it loops around.
+	 * If the end of the data is reached, it loops around. Without any data, the output is 0.
 	 */
 	virtual void Update();
 
@@ -50,35 +57,39 @@ public:
 	 * \brief Sets the data this filter outputs.
 	 *
 	 * \param out The data this filter outputs.
+	 * \param split Wether to store \ref Complex data split into the real and the imaginary part. This defaults to `false`.
 	 */
-	void SetInput(std::vector<Tout> out);
+	void SetInput(std::vector<Tout> out, bool split = false);
 
 	/**
 	 * \brief Sets the data this filter outputs.
 	 * \param out The data this filter outputs.
+	 * \param split Wether to store \ref Complex data split into the real and the imaginary part. This defaults to `false`.
 	 */
-	void SetInput(std::vector<Tout>&& out);
+	void SetInput(std::vector<Tout>&& out, bool split = false);
 
 private:
-	std::vector<Tout> output_samples;	///< A copy of the data to output.
+	std::vector<Tout> output_samples;	///< A copy of the data to output, empty if it is split.
+	AlignedStdVec<Real> split_real;		///< The real part of the data to output, if it is split.
+	AlignedStdVec<Real> split_imag;		///< The imaginary part of the data to output, if it is split.
+	size_t sample_count = 0;			///< The number of samples of the data.
 
-	uint32_t current_sample = 0;		///< The index of the current sample.
+	size_t current_sample = 0;			///< The index of the current sample.
 
 
 	/**
-	 * \brief Update \ref current_sample to point to the sample that has to be returned next.
+	 * \brief Split \ref Complex data into \ref split_real and \ref split_imag, if requested.
+	 * \param split Wether to split the data.
 	 */
-	void NextSample();
-};
-
+	void Split(bool split);
 
-//---------- inlined / templated functions implementation ----------//
-
-template<typename Tout>
-inline void VectorInput<Tout>::NextSample()
-{
-	current_sample = (current_sample + 1) % output_samples.size();
-}
+	/**
+	 * \brief Copy a run of samples without wrap around to the output.
+	 * \param offset The index of the first output sample to write.
+	 * \param count The number of samples to copy, starting at \ref current_sample.
+	 */
+	void Copy(size_t offset, size_t count);
+};
 
 
-#endif //FILTER_VECTOR_INPUT_H_
\ No newline at end of file
+#endif //FILTER_VECTOR_INPUT_H_
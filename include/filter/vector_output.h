@@ -4,24 +4,49 @@
 #include <types.h>
 #include <filter/filter.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <deque>
 #include <vector>
 
 
 /**\ingroup group_filters
  * \brief Stores all input it receives inside a `std::vector`.
  *
+ * The samples are collected in a deque of aligned chunks of \ref ChunkSize samples, split into the real and the
+ * imaginary part like the filter outputs. Every update copies one SIMD register per part, and a long run never
+ * copies the samples stored before. With a limit, the chunks of the oldest samples are reused, so only the most
+ * recent samples are kept in a bounded amount of memory.
+ *
+ * The samples can be read in place with \ref GetSegment(), or copied once into memory of the caller with \ref CopyTo().
+ * \ref GetStored() instead keeps a contiguous copy of all stored samples, which is extended by the samples stored
+ * since the last call and freed by \ref ReleaseStored().
+ *
  * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
  */
 template<typename Tin>
 class VectorOutput : public Filter
 {
 public:
+	static constexpr size_t ChunkSize = 16384;	///< The number of samples per chunk
+
+	/**
+	 * \brief Consecutive stored samples in the same chunk.
+	 */
+	struct Segment {
+		const Real* real;	///< The real parts of the samples
+		const Real* imag;	///< The imaginary parts of the samples, `nullptr` for \ref Real input
+		size_t size;		///< The number of samples
+	};
+
 	/**
 	 * \brief Constructor
 	 *
 	 * \param sample_rate The number of samples per second produced by the input to this filter.
+	 * \param capacity The number of samples expected. The chunks for them are allocated up front. This defaults to 0.
+	 * \param limit The number of most recent samples to keep. A value of 0 keeps all samples. This defaults to 0.
 	 */
-	VectorOutput(double sample_rate);
+	VectorOutput(double sample_rate, size_t capacity = 0, size_t limit = 0);
 
 
 	/**
@@ -34,13 +59,116 @@ public:
 
 	/**
 	 * \brief Access the stored samples.
-	 * \returns A const reference to the vector storing the samples.
+	 *
+	 * The samples are copied into a vector kept by this filter, so they take twice the memory until \ref ReleaseStored() is called.
+	 *
+	 * \returns A const reference to the vector storing the samples. It is only updated by the next call to this function.
 	 */
 	const std::vector<Tin>& GetStored() const;
 
+	/**
+	 * \brief Free the vector returned by \ref GetStored().
+	 */
+	void ReleaseStored() const;
+
+	/**
+	 * \brief Copy the stored samples into memory of the caller.
+	 * \param data The array to copy the samples to. It has to hold \ref Size() samples.
+	 */
+	void CopyTo(Tin* data) const;
+
+	/**
+	 * \brief Get the number of segments the stored samples are split into.
+	 * \returns The number of segments, which is 0 if no samples are stored.
+	 */
+	size_t SegmentCount() const;
+
+	/**
+	 * \brief Access stored samples without copying them.
+	 * \param index The number of the segment, starting with the oldest samples. Has to be smaller than \ref SegmentCount().
+	 * \returns The samples of the segment. They stay valid until the next call to \ref Update().
+	 */
+	Segment GetSegment(size_t index) const;
+
+	/**
+	 * \brief Get the number of stored samples.
+	 * \returns The number of samples \ref GetStored() returns, which is at most the limit.
+	 */
+	size_t Size() const;
+
+	/**
+	 * \brief Get the number of samples received.
+	 * \returns The number of samples received since the construction, including the ones dropped because of the limit.
+	 */
+	size_t Count() const;
+
 private:
-	std::vector<Tin> output;	///< All samples are stored in this vector.
+	/**
+	 * \brief The aligned memory of \ref ChunkSize samples.
+	 */
+	struct Chunk {
+		AlignedStdVec<Real> real;	///< The real parts of the samples
+		AlignedStdVec<Real> imag;	///< The imaginary parts of the samples, empty for \ref Real input
+	};
+
+	const size_t limit;				///< The number of most recent samples to keep, or 0
+	std::deque<Chunk> chunks;		///< The stored samples, followed by the chunks allocated up front
+	size_t first_sample = 0;		///< The number of the first sample in the first chunk
+	size_t count = 0;				///< The number of samples received
+
+	mutable std::vector<Tin> output;	///< The stored samples put together by \ref GetStored()
+	mutable size_t output_begin = 0;	///< The number of the first sample in \ref output
+	mutable size_t output_end = 0;		///< The number of the sample after the last one in \ref output
+
+	/**
+	 * \brief Get the chunk the next sample is stored in, adding or reusing one if needed.
+	 * \returns The chunk of sample \ref count.
+	 */
+	Chunk& NextChunk();
+
+	/**
+	 * \brief Append stored samples to \ref output.
+	 * \param begin The number of the first sample to append.
+	 * \param end The number of the sample after the last one to append.
+	 */
+	void AppendOutput(size_t begin, size_t end) const;
 };
 
 
-#endif //FILTER_VECTOR_OUTPUT_H_
\ No newline at end of file
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline size_t VectorOutput<Tin>::Size() const
+{
+	return limit == 0 ? count : std::min(count, limit);
+}
+
+
+template<typename Tin>
+inline size_t VectorOutput<Tin>::Count() const
+{
+	return count;
+}
+
+
+template<typename Tin>
+inline size_t VectorOutput<Tin>::SegmentCount() const
+{
+	const size_t start = count - Size() - first_sample;
+	return Size() == 0 ? 0 : (start + Size() + ChunkSize - 1) / ChunkSize - start / ChunkSize;
+}
+
+
+template<typename Tin>
+inline typename VectorOutput<Tin>::Segment VectorOutput<Tin>::GetSegment(size_t index) const
+{
+	const size_t start = count - Size() - first_sample;
+	const size_t chunk_index = start / ChunkSize + index;
+	const Chunk& chunk = chunks[chunk_index];
+	const size_t begin = index == 0 ? start % ChunkSize : 0;
+	const size_t end = std::min(ChunkSize, count - first_sample - chunk_index * ChunkSize);
+	return { chunk.real.data() + begin, chunk.imag.empty() ? nullptr : chunk.imag.data() + begin, end - begin };
+}
+
+
+#endif //FILTER_VECTOR_OUTPUT_H_
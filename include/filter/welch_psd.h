@@ -0,0 +1,102 @@
+#ifndef FILTER_WELCH_PSD_H_
+#define FILTER_WELCH_PSD_H_
+
+#include <filter/stft.h>
+#include <filter/window_functions.h>
+#include <types.h>
+#include <cstdint>
+#include <functional>
+
+
+/**\ingroup group_filters
+ * \brief Estimate the power spectral density of the input signal with Welch's method.
+ *
+ * The squared magnitudes of the overlapping, windowed frames of the underlying \ref Stft are summed up in place.
+ * After every `average_count` frames, their average becomes available through \ref Spectrum()
+ * and \ref SpectrumReady() returns `true` until the next call to \ref Update(). Only one frame
+ * and one sum are stored, so the memory used does not depend on the length of the input.
+ *
+ * \tparam Tin The type of input this filter accepts. Either has to be \ref Real or \ref Complex.
+ */
+template<typename Tin>
+class WelchPsd : public Stft<Tin>
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param sample_rate The number of samples per second at the input of this filter.
+	 * \param size The number of samples per frame. Has to be a power of two.
+	 * \param hop The number of samples between the start of two frames. Has to be a multiple of \ref RealSimd::static_size.
+	 * \param average_count The number of frames averaged for every spectrum.
+	 * \param window_function The window function to weigh the samples of a frame with. This defaults to \ref Hann.
+	 */
+	WelchPsd(double sample_rate, uint32_t size, uint32_t hop, uint32_t average_count, const std::function<Real(Real)>& window_function = Hann);
+
+
+	/**
+	 * \brief Update this filter.
+	 */
+	virtual void Update();
+
+
+	/**
+	 * \brief Check if the last call to \ref Update() completed a new spectrum.
+	 * \returns `true` if there is a new spectrum.
+	 */
+	bool SpectrumReady() const;
+
+	/**
+	 * \brief Get the last averaged spectrum.
+	 *
+	 * Bin `k` contains the power per Hz around the frequency `k * SampleRateIn() / Size()`. The spectrum is two sided,
+	 * so for a \ref Real input the bins above `Size() / 2` mirror the ones below, and the total power is the sum over all bins
+	 * times the bin width.
+	 *
+	 * \returns A pointer to \ref Size() aligned values.
+	 */
+	const Real* Spectrum() const;
+
+	/**
+	 * \brief Get the number of frames averaged for every spectrum.
+	 * \returns The number of frames per spectrum.
+	 */
+	uint32_t AverageCount() const;
+
+	using Stft<Tin>::Size;
+
+private:
+	const uint32_t average_count;	///< The number of frames averaged for every spectrum
+	Real scale;						///< The factor converting a sum of squared magnitudes to the power spectral density
+
+	AlignedStdVec<Real> sum;		///< The sum of the squared magnitudes of the frames of the current spectrum
+	AlignedStdVec<Real> spectrum;	///< The last averaged spectrum
+
+	uint32_t frame_count = 0;		///< The number of frames in \ref sum
+	bool spectrum_ready = false;	///< Wether the last update completed a spectrum
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+template<typename Tin>
+inline bool WelchPsd<Tin>::SpectrumReady() const
+{
+	return spectrum_ready;
+}
+
+
+template<typename Tin>
+inline const Real* WelchPsd<Tin>::Spectrum() const
+{
+	return spectrum.data();
+}
+
+
+template<typename Tin>
+inline uint32_t WelchPsd<Tin>::AverageCount() const
+{
+	return average_count;
+}
+
+
+#endif //FILTER_WELCH_PSD_H_
@@ -49,10 +49,10 @@ inline Real Sine_impl(uint64_t power, Real x)
  * \param x A value in the interval [0, 1]
  * \returns The magnitude of the Rectangular window at `x`
  */
-std::function<Real(Real)> Rectangular([&](Real x)->Real
+inline Real Rectangular(Real x)
 {
 	return x >= 0 && x <= 1 ? Real(1) : Real(0);
-});
+}
 
 
 /**
@@ -63,7 +63,7 @@ std::function<Real(Real)> Rectangular([&](Real x)->Real
  * \param order The order of the B-Spline window
  * \returns A `std::function` mapping values in the interval [0, 1] to a B-Spline of order `order`.
  */
-std::function<Real(Real)> BSpline(uint64_t order)
+inline std::function<Real(Real)> BSpline(uint64_t order)
 {
 	return std::bind(BSpline_impl, order, std::placeholders::_1);
 }
@@ -75,12 +75,12 @@ std::function<Real(Real)> BSpline(uint64_t order)
  * \param x A value in the Interval [0, 1]
  * \returns The magnitude of the Hamming window at position `x`.
  */
-std::function<Real(Real)> Hamming([&](Real x)->Real
+inline Real Hamming(Real x)
 {
 	constexpr Real alpha = Real(25) / 46;
 	constexpr Real beta = Real(1) - alpha;
 	return static_cast<Real>(alpha - beta * std::cos(x * boost::math::constants::two_pi<Real>()));
-});
+}
 
 
 /**
@@ -89,7 +89,10 @@ std::function<Real(Real)> Hamming([&](Real x)->Real
  * \param x A value in the interval [0, 1]
  * \returns The magnitude of the Parzen window at position `x`.
  */
-std::function<Real(Real)> Parzen(BSpline(3));
+inline Real Parzen(Real x)
+{
+	return BSpline_impl(3, x);
+}
 
 
 /**
@@ -100,7 +103,7 @@ std::function<Real(Real)> Parzen(BSpline(3));
  * \param power The power to raise the sine to.
  * \returns A window function mapping the interval [0, 1] to the magnitudes of the Sind window.
  */
-std::function<Real(Real)> Sine(uint64_t power)
+inline std::function<Real(Real)> Sine(uint64_t power)
 {
 	return std::bind(Sine_impl, power, std::placeholders::_1);
 }
@@ -112,7 +115,10 @@ std::function<Real(Real)> Sine(uint64_t power)
  * \param x A value in the interval [0, 1]
  * \returns The magnitude of the Hann window at position `x`
  */
-std::function<Real(Real)> Hann(Sine(2));
+inline Real Hann(Real x)
+{
+	return Sine_impl(2, x);
+}
 
 
 /**
@@ -121,7 +127,10 @@ std::function<Real(Real)> Hann(Sine(2));
  * \param x A value in the interval [0, 1]
  * \returns The magnitude of the Triangular window at position `x`
  */
-std::function<Real(Real)> Triangular(BSpline(1));
+inline Real Triangular(Real x)
+{
+	return BSpline_impl(1, x);
+}
 
 
 /**
@@ -130,11 +139,11 @@ std::function<Real(Real)> Triangular(BSpline(1));
  * \param x A value in the interval [0, 1]
  * \returns The magnitude of the Welch window at position `x`
  */
-std::function<Real(Real)> Welch([&](Real x)->Real
+inline Real Welch(Real x)
 {
 	Real shifted = x - Real(0.5);
 	return Real(1.0) - 4 * shifted*shifted;
-});
+}
 
 
 
@@ -12,36 +12,74 @@
  * \defgroup group_filters Filter
  * \brief This module contains various filters for signal processing.
  *
- * There currently are 8 signal processing filters and 4 IO filters supported by the library:
+ * There currently are 21 signal processing filters and 10 IO filters supported by the library:
  * + IO
  *    - \ref VectorInput
  *    - \ref RiffWaveInput
+ *    - \ref RawIqInput
+ *    - \ref ShmRingInput
+ *    - \ref ExternalBufferInput
  *    - \ref VectorOutput
  *    - \ref RiffWaveOutput
+ *    - \ref RawIqOutput
+ *    - \ref ShmRingOutput
+ *    - \ref ExternalBufferOutput
  * + Signal Processing
  *    - \ref FrequencyGenerator
  *    - \ref FrequencyShift
  *    - \ref AmplitudeModulator
  *    - \ref FrequencyModulator
+ *    - \ref FmDemodulator
+ *    - \ref AnalyticSignal
+ *    - \ref EnvelopeDetector
  *    - \ref Fir
  *    - \ref Differentiator
  *    - \ref Cic
  *    - \ref LowPass
+ *    - \ref BiquadCascade
+ *    - \ref Decimator
+ *    - \ref Correlator
+ *    - \ref Stft
+ *    - \ref WelchPsd
+ *    - \ref GoertzelBank
+ *    - \ref BatchFir
+ *    - \ref BatchBiquadCascade
+ *    - \ref BatchDifferentiator
+ *    - \ref BatchFrequencyShift
  */
 
 
 #include <filter/vector_input.h>
 #include <filter/riff_wave_input.h>
+#include <filter/raw_iq_input.h>
+#include <filter/shm_ring_input.h>
+#include <filter/external_buffer_input.h>
 #include <filter/frequency_generator.h>
 #include <filter/frequency_shift.h>
 #include <filter/amplitude_modulator.h>
 #include <filter/frequency_modulator.h>
+#include <filter/fm_demodulator.h>
+#include <filter/analytic_signal.h>
+#include <filter/envelope_detector.h>
 #include <filter/fir.h>
 #include <filter/differentiator.h>
 #include <filter/low_pass.h>
 #include <filter/cic.h>
+#include <filter/biquad_cascade.h>
+#include <filter/decimator.h>
+#include <filter/correlator.h>
+#include <filter/stft.h>
+#include <filter/welch_psd.h>
+#include <filter/goertzel_bank.h>
+#include <filter/batch_fir.h>
+#include <filter/batch_biquad_cascade.h>
+#include <filter/batch_differentiator.h>
+#include <filter/batch_frequency_shift.h>
 #include <filter/vector_output.h>
 #include <filter/riff_wave_output.h>
+#include <filter/raw_iq_output.h>
+#include <filter/shm_ring_output.h>
+#include <filter/external_buffer_output.h>
 
 
 #endif //FILTER_H_
\ No newline at end of file
@@ -0,0 +1,165 @@
+#ifndef IO_CHUNK_QUEUE_H_
+#define IO_CHUNK_QUEUE_H_
+
+#include <boost/lockfree/spsc_queue.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+
+/**
+ * \brief A fixed pool of buffers passed back and forth between two threads.
+ *
+ * One thread fills the buffers and the other one drains them: The filling thread takes an empty chunk with
+ * \ref PopEmpty() and hands it over with \ref PushFull(), the draining thread takes it with \ref PopFull() and
+ * returns it with \ref PushEmpty(). Both directions are single producer, single consumer queues, so no locks
+ * are needed to pass a chunk and no memory is allocated after construction. A thread finding its queue empty
+ * sleeps in \ref WaitPopEmpty() or \ref WaitPopFull() on a condition variable, which every push signals.
+ */
+class ChunkQueue
+{
+public:
+	/**
+	 * \brief A buffer and the number of valid bytes in it.
+	 *
+	 * The thread holding a chunk owns its buffer and may resize it.
+	 */
+	struct Chunk {
+		std::vector<uint8_t>* bytes;	///< The buffer
+		size_t size;					///< The number of bytes at the start of the buffer which contain data
+	};
+
+
+	/**
+	 * \brief Constructor
+	 * \param chunk_count The number of buffers in the pool.
+	 * \param chunk_size The size of every buffer in bytes.
+	 */
+	ChunkQueue(size_t chunk_count, size_t chunk_size);
+
+
+	/**
+	 * \brief Take an empty chunk to fill.
+	 * \param chunk Is set to the chunk taken.
+	 * \returns `false` if all chunks are in use.
+	 */
+	bool PopEmpty(Chunk& chunk);
+
+	/**
+	 * \brief Take an empty chunk to fill, waiting until there is one.
+	 * \param chunk Is set to the chunk taken.
+	 * \param cancel Stops the waiting once it is set and \ref Wake() is called.
+	 * \returns `false` if the waiting was cancelled before a chunk was returned.
+	 */
+	bool WaitPopEmpty(Chunk& chunk, const std::atomic<bool>& cancel);
+
+	/**
+	 * \brief Pass a filled chunk on to the draining thread.
+	 * \param chunk The chunk taken with \ref PopEmpty().
+	 */
+	void PushFull(const Chunk& chunk);
+
+	/**
+	 * \brief Take the oldest filled chunk.
+	 * \param chunk Is set to the chunk taken.
+	 * \returns `false` if there is no filled chunk.
+	 */
+	bool PopFull(Chunk& chunk);
+
+	/**
+	 * \brief Take the oldest filled chunk, waiting until there is one.
+	 * \param chunk Is set to the chunk taken.
+	 * \param cancel Stops the waiting once it is set and \ref Wake() is called. The chunks pushed before are still taken.
+	 * \returns `false` if the waiting was cancelled and there is no filled chunk.
+	 */
+	bool WaitPopFull(Chunk& chunk, const std::atomic<bool>& cancel);
+
+	/**
+	 * \brief Return a drained chunk to the filling thread.
+	 * \param chunk The chunk taken with \ref PopFull().
+	 */
+	void PushEmpty(const Chunk& chunk);
+
+	/**
+	 * \brief Return all filled chunks to the pool.
+	 *
+	 * This may only be called by the draining thread while the filling thread is not running.
+	 */
+	void Reset();
+
+	/**
+	 * \brief Wake the waiting threads, so they check their cancel flag.
+	 */
+	void Wake();
+
+private:
+	std::vector<std::vector<uint8_t>> buffers;		///< The memory of all chunks
+	boost::lockfree::spsc_queue<Chunk> empty;		///< The chunks waiting to be filled
+	boost::lockfree::spsc_queue<Chunk> full;		///< The chunks waiting to be drained
+
+	std::mutex mutex;							///< Protects the waiting on the condition variables
+	std::condition_variable empty_pushed;		///< Signalled whenever a chunk is returned to \ref empty
+	std::condition_variable full_pushed;		///< Signalled whenever a chunk is passed on to \ref full
+
+	/**
+	 * \brief Wait until a queue has a chunk.
+	 * \param queue The queue to pop from.
+	 * \param pushed The condition variable signalled by pushes to the queue.
+	 * \param chunk Is set to the chunk taken.
+	 * \param cancel Stops the waiting once it is set.
+	 * \returns `false` if the waiting was cancelled and the queue is empty.
+	 */
+	bool WaitPop(boost::lockfree::spsc_queue<Chunk>& queue, std::condition_variable& pushed, Chunk& chunk, const std::atomic<bool>& cancel);
+
+	/**
+	 * \brief Signal a thread waiting on a condition variable.
+	 * \param pushed The condition variable of the queue pushed to.
+	 */
+	void Notify(std::condition_variable& pushed);
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+inline bool ChunkQueue::PopEmpty(Chunk& chunk)
+{
+	return empty.pop(chunk);
+}
+
+
+inline bool ChunkQueue::WaitPopEmpty(Chunk& chunk, const std::atomic<bool>& cancel)
+{
+	return WaitPop(empty, empty_pushed, chunk, cancel);
+}
+
+
+inline void ChunkQueue::PushFull(const Chunk& chunk)
+{
+	full.push(chunk);
+	Notify(full_pushed);
+}
+
+
+inline bool ChunkQueue::PopFull(Chunk& chunk)
+{
+	return full.pop(chunk);
+}
+
+
+inline bool ChunkQueue::WaitPopFull(Chunk& chunk, const std::atomic<bool>& cancel)
+{
+	return WaitPop(full, full_pushed, chunk, cancel);
+}
+
+
+inline void ChunkQueue::PushEmpty(const Chunk& chunk)
+{
+	empty.push(chunk);
+	Notify(empty_pushed);
+}
+
+
+#endif //IO_CHUNK_QUEUE_H_
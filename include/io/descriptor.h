@@ -0,0 +1,69 @@
+#ifndef IO_DESCRIPTOR_H_
+#define IO_DESCRIPTOR_H_
+
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * \file io/descriptor.h
+ * \brief Reading and writing file descriptors, e.g. the standard input and output of a process chained with pipes.
+ *
+ * These functions hide the differences between the POSIX and the Windows runtime. The descriptors belong to the
+ * caller and are never closed implicitly.
+ */
+
+
+constexpr int StandardInput = 0;	///< The file descriptor of the standard input
+constexpr int StandardOutput = 1;	///< The file descriptor of the standard output
+
+
+/**
+ * \brief Prepare a file descriptor for the transfer of large blocks of binary data.
+ *
+ * On Windows, the descriptor is switched to binary mode, so no line endings are translated. On Linux, the
+ * buffer of a pipe is enlarged to `size` bytes if possible, so the processes on both ends are woken up less often.
+ *
+ * \param descriptor The file descriptor.
+ * \param size The number of bytes transferred at once.
+ */
+void PrepareDescriptor(int descriptor, size_t size);
+
+/**
+ * \brief Read from a file descriptor.
+ *
+ * Pipes return the data in the pieces they were written in, so by default this keeps reading until all bytes arrived.
+ *
+ * \param descriptor The file descriptor to read from.
+ * \param data The array to store the bytes in.
+ * \param size The number of bytes to read.
+ * \param complete Wether to wait for all bytes. Otherwise, this returns as soon as some bytes arrived. This defaults to `true`.
+ * \returns The number of bytes read. If `complete` is `true`, this is only less than `size` at the end of the data
+ *          or after an error. Otherwise, it is only 0 at the end of the data or after an error.
+ */
+size_t ReadDescriptor(int descriptor, uint8_t* data, size_t size, bool complete = true);
+
+/**
+ * \brief Write to a file descriptor.
+ * \param descriptor The file descriptor to write to.
+ * \param data The bytes to write.
+ * \param size The number of bytes to write.
+ * \returns `false` if not all bytes could be written, e.g. because the reading end of the pipe was closed.
+ */
+bool WriteDescriptor(int descriptor, const uint8_t* data, size_t size);
+
+/**
+ * \brief Create a pipe.
+ * \param descriptors Receives the descriptor of the reading end at index 0 and the one of the writing end at index 1.
+ * \returns `false` if the pipe couldn't be created.
+ */
+bool OpenPipe(int descriptors[2]);
+
+/**
+ * \brief Close a file descriptor.
+ * \param descriptor The file descriptor. Closing the writing end of a pipe ends the data of the reading end.
+ */
+void CloseDescriptor(int descriptor);
+
+
+#endif //IO_DESCRIPTOR_H_
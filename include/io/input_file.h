@@ -0,0 +1,199 @@
+#ifndef IO_INPUT_FILE_H_
+#define IO_INPUT_FILE_H_
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <io/chunk_queue.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/**
+ * \brief The way an \ref InputFile gets the data from the disk.
+ */
+enum FileReadMode {
+	FILE_READ_STREAM,	///< Read through a `std::ifstream` into a buffer, which is reused for every read.
+	FILE_READ_MAPPED,	///< Map the file read-only into memory. Reads return pointers straight into the mapping and the OS is advised to prefetch sequentially.
+	FILE_READ_ASYNC		///< Read ahead on a background thread into a small pool of buffers, so reading never waits for the disk as long as the disk keeps up.
+};
+
+
+/**
+ * \brief Reads a contiguous range of bytes from a file, one chunk after the other.
+ *
+ * This is the part shared by all file sources: They know where their samples start and how many bytes there are,
+ * and only ask for pointers to the next bytes to convert. Depending on the \ref FileReadMode, those pointers
+ * either point into a buffer owned by this class or directly into the memory mapped file, so no copy of the data is made.
+ *
+ * In \ref FILE_READ_ASYNC mode, a background thread fills the buffers of a \ref ChunkQueue while the data of the
+ * previous ones is processed. Reads return pointers into the current buffer and only copy, if the requested bytes
+ * span two buffers.
+ *
+ * Instead of a named file, the data can also be read from a file descriptor, e.g. the standard input of a process
+ * at the end of a pipe. Such a stream has no known length and can only be read forwards.
+ */
+class InputFile
+{
+public:
+	/**
+	 * \brief Constructor
+	 * \param path The path to the file to read.
+	 * \param offset The position of the first byte to read in the file.
+	 * \param length The number of bytes to read, starting at `offset`. It is reduced if the file ends earlier.
+	 * \param mode The way the data is read. This defaults to \ref FILE_READ_STREAM.
+	 * \throws std::runtime_error If the file can't be opened.
+	 */
+	InputFile(const std::string& path, uint64_t offset, uint64_t length, FileReadMode mode = FILE_READ_STREAM);
+
+	/**
+	 * \brief Constructor
+	 * \param descriptor The file descriptor to read from, e.g. \ref StandardInput. It is not closed by this class.
+	 * \param mode The way the data is read. A pipe can't be mapped, so \ref FILE_READ_MAPPED reads like \ref FILE_READ_STREAM.
+	 *             This defaults to \ref FILE_READ_STREAM.
+	 */
+	InputFile(int descriptor, FileReadMode mode = FILE_READ_STREAM);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Stops the background thread in \ref FILE_READ_ASYNC mode.
+	 */
+	~InputFile();
+
+
+	/**
+	 * \brief Read the next bytes.
+	 * \param size The number of bytes to read. Is set to the number of bytes actually read, which is less at the end of the range.
+	 * \returns A pointer to the bytes read. It stays valid until the next call to \ref Read() or \ref Seek().
+	 */
+	const uint8_t* Read(size_t& size);
+
+	/**
+	 * \brief Continue reading at a given position.
+	 *
+	 * A file descriptor can only be moved forwards, which reads and drops the bytes in between.
+	 *
+	 * \param position The number of bytes from the start of the range.
+	 */
+	void Seek(uint64_t position);
+
+	/**
+	 * \brief Get the read position.
+	 * \returns The number of bytes from the start of the range to the next byte to read.
+	 */
+	uint64_t Position() const;
+
+	/**
+	 * \brief Get the length of the range.
+	 * \returns The number of bytes in the range. The length of a file descriptor is unknown, so it is the largest `uint64_t`.
+	 */
+	uint64_t Length() const;
+
+	/**
+	 * \brief Check if the read position can be moved backwards.
+	 * \returns `false` for a file descriptor.
+	 */
+	bool Seekable() const;
+
+	/**
+	 * \brief Get the way the data is read.
+	 * \returns The \ref FileReadMode passed to the constructor.
+	 */
+	FileReadMode Mode() const;
+
+
+	static constexpr size_t BufferSize = 1 << 20;	///< The size of every buffer in \ref FILE_READ_ASYNC mode
+	static constexpr size_t BufferCount = 4;		///< The number of buffers in \ref FILE_READ_ASYNC mode
+
+private:
+	const FileReadMode mode;	///< The way the data is read
+	const uint64_t offset;		///< The position of the range in the file
+	const uint64_t length;		///< The number of bytes in the range
+	uint64_t position = 0;		///< The position of the next byte to read relative to the start of the range
+	const int descriptor = -1;	///< The file descriptor to read from instead of \ref file, if not negative
+
+	std::ifstream file;				///< The file in \ref FILE_READ_STREAM mode
+	std::vector<uint8_t> buffer;	///< The bytes of the last read in \ref FILE_READ_STREAM mode
+
+	boost::interprocess::file_mapping mapping;		///< The file in \ref FILE_READ_MAPPED mode
+	boost::interprocess::mapped_region region;		///< The mapped range in \ref FILE_READ_MAPPED mode
+
+	std::unique_ptr<ChunkQueue> chunks;		///< The buffers passed between the threads in \ref FILE_READ_ASYNC mode
+	ChunkQueue::Chunk current = { nullptr, 0 };	///< The buffer currently read from
+	size_t current_position = 0;			///< The position of the next byte to read in \ref current
+	std::thread thread;						///< The thread reading ahead
+	std::atomic<bool> stop{ false };		///< Tells the thread to stop reading
+	std::atomic<bool> finished{ false };	///< Set by the thread when it read all it could
+
+	/**
+	 * \brief Read from the file or file descriptor into memory.
+	 * \param data The array to store the bytes in.
+	 * \param size The number of bytes to read.
+	 * \returns The number of bytes read, which is less than `size` at the end of the file.
+	 */
+	size_t ReadBytes(uint8_t* data, size_t size);
+
+	/**
+	 * \brief Read from the buffers filled by the background thread.
+	 * \param size The number of bytes to read. Is set to the number of bytes actually read.
+	 * \returns A pointer to the bytes read.
+	 */
+	const uint8_t* ReadAsync(size_t& size);
+
+	/**
+	 * \brief Return the current buffer and wait for the next one.
+	 * \returns `false` if the background thread finished without filling another buffer.
+	 */
+	bool NextChunk();
+
+	/**
+	 * \brief Start the background thread at the current position.
+	 */
+	void StartThread();
+
+	/**
+	 * \brief Stop the background thread and drop the data it read ahead.
+	 */
+	void StopThread();
+
+	/**
+	 * \brief The function run by the background thread.
+	 * \param start The position to start reading at.
+	 */
+	void ReadAhead(uint64_t start);
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+inline uint64_t InputFile::Position() const
+{
+	return position;
+}
+
+
+inline uint64_t InputFile::Length() const
+{
+	return length;
+}
+
+
+inline FileReadMode InputFile::Mode() const
+{
+	return mode;
+}
+
+
+inline bool InputFile::Seekable() const
+{
+	return descriptor < 0;
+}
+
+
+#endif //IO_INPUT_FILE_H_
@@ -0,0 +1,202 @@
+#ifndef IO_OUTPUT_FILE_H_
+#define IO_OUTPUT_FILE_H_
+
+#include <io/chunk_queue.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/**
+ * \brief The way an \ref OutputFile gets the data to the disk.
+ */
+enum FileWriteMode {
+	FILE_WRITE_BUFFERED,	///< Write the buffer on the calling thread whenever it is full.
+	FILE_WRITE_ASYNC		///< Hand full buffers over to a background thread, which writes them while the next ones are filled.
+};
+
+
+/**
+ * \brief Writes a file through a large buffer.
+ *
+ * This is the part shared by all file sinks: Instead of writing every frame separately, they reserve space
+ * at the end of the buffer with \ref Append(), convert their samples directly into it and leave it to this class
+ * to write the whole buffer at once when it is full. The buffer is allocated once and reused for the whole file.
+ *
+ * In \ref FILE_WRITE_ASYNC mode, there is a small pool of buffers in a \ref ChunkQueue. Full buffers are written
+ * by a background thread, so appending only waits for the disk if all buffers are full.
+ *
+ * Instead of a named file, the data can also be written to a file descriptor, e.g. the standard output of a process
+ * at the start of a pipe. Bytes written to a file descriptor can't be overwritten anymore.
+ */
+class OutputFile
+{
+public:
+	/**
+	 * \brief The number of bytes collected before they are written to the file.
+	 */
+	static constexpr size_t BufferSize = 1 << 20;
+
+	/**
+	 * \brief The number of buffers in \ref FILE_WRITE_ASYNC mode.
+	 */
+	static constexpr size_t BufferCount = 4;
+
+
+	/**
+	 * \brief Constructor
+	 * \param path The path to the file to write. An existing file is overwritten.
+	 * \param mode The way the data is written. This defaults to \ref FILE_WRITE_BUFFERED.
+	 */
+	OutputFile(const std::string& path, FileWriteMode mode = FILE_WRITE_BUFFERED);
+
+	/**
+	 * \brief Constructor
+	 * \param descriptor The file descriptor to write to, e.g. \ref StandardOutput. It is not closed by this class.
+	 * \param mode The way the data is written. This defaults to \ref FILE_WRITE_BUFFERED.
+	 */
+	OutputFile(int descriptor, FileWriteMode mode = FILE_WRITE_BUFFERED);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Writes the remaining data and closes the file.
+	 */
+	~OutputFile();
+
+
+	/**
+	 * \brief Reserve space for the next bytes.
+	 * \param size The number of bytes to append to the file.
+	 * \returns A pointer to `size` bytes which have to be filled before the next call to any other function.
+	 */
+	uint8_t* Append(size_t size);
+
+	/**
+	 * \brief Append bytes to the file.
+	 * \param data The bytes to append.
+	 * \param size The number of bytes to append.
+	 */
+	void Write(const void* data, size_t size);
+
+	/**
+	 * \brief Overwrite bytes already written, e.g. to update the headers.
+	 *
+	 * The buffered bytes are written first. Writing past the end extends the file. This is not possible for a file descriptor.
+	 *
+	 * \param position The position of the first byte to overwrite.
+	 * \param data The new bytes.
+	 * \param size The number of bytes to overwrite.
+	 */
+	void WriteAt(uint64_t position, const void* data, size_t size);
+
+	/**
+	 * \brief Pass the buffered bytes on to the file.
+	 *
+	 * In \ref FILE_WRITE_ASYNC mode, they are written by the background thread some time later.
+	 */
+	void Flush();
+
+	/**
+	 * \brief Write the buffered bytes and close the file.
+	 *
+	 * A file descriptor is only flushed and stays open.
+	 */
+	void Close();
+
+
+	/**
+	 * \brief Get the size of the file.
+	 * \returns The number of bytes appended so far, including the ones not yet written.
+	 */
+	uint64_t Position() const;
+
+	/**
+	 * \brief Check if the file is open.
+	 * \returns `false` after \ref Close() was called.
+	 */
+	bool IsOpen() const;
+
+	/**
+	 * \brief Check if bytes already written can be overwritten.
+	 * \returns `false` for a file descriptor.
+	 */
+	bool Seekable() const;
+
+private:
+	const FileWriteMode mode;		///< The way the data is written
+	std::ofstream file;				///< The file to write to
+	int descriptor = -1;			///< The file descriptor to write to instead of \ref file, if not negative. It is reset by \ref Close().
+	const bool seekable;			///< Wether the data is written to \ref file
+	std::vector<uint8_t> buffer;	///< The buffer in \ref FILE_WRITE_BUFFERED mode
+	std::vector<uint8_t>* current;	///< The buffer currently appended to
+	size_t used = 0;				///< The number of bytes in \ref current
+	uint64_t written = 0;			///< The number of bytes passed on to the file
+
+	std::unique_ptr<ChunkQueue> chunks;		///< The buffers passed between the threads in \ref FILE_WRITE_ASYNC mode
+	std::thread thread;						///< The thread writing the full buffers
+	std::atomic<bool> stop{ false };		///< Tells the thread to stop after writing all full buffers
+
+	/**
+	 * \brief Write bytes to the file or file descriptor.
+	 * \param data The bytes to write.
+	 * \param size The number of bytes to write.
+	 */
+	void WriteBytes(const uint8_t* data, size_t size);
+
+	/**
+	 * \brief Start the background thread.
+	 */
+	void StartThread();
+
+	/**
+	 * \brief Wait until the background thread wrote all full buffers and stop it.
+	 */
+	void StopThread();
+
+	/**
+	 * \brief The function run by the background thread.
+	 */
+	void WriteBehind();
+};
+
+
+//---------- inlined / templated functions implementation ----------//
+
+inline uint8_t* OutputFile::Append(size_t size)
+{
+	if (used + size > current->size()) {
+		Flush();
+		if (size > current->size())
+			current->resize(size);
+	}
+	uint8_t* data = current->data() + used;
+	used += size;
+	return data;
+}
+
+
+inline uint64_t OutputFile::Position() const
+{
+	return written + used;
+}
+
+
+inline bool OutputFile::IsOpen() const
+{
+	return file.is_open() || descriptor >= 0;
+}
+
+
+inline bool OutputFile::Seekable() const
+{
+	return seekable;
+}
+
+
+#endif //IO_OUTPUT_FILE_H_
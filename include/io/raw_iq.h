@@ -0,0 +1,64 @@
+#ifndef IO_RAW_IQ_H_
+#define IO_RAW_IQ_H_
+
+#include <types.h>
+#include <boost/assert.hpp>
+#include <cstddef>
+
+
+/**
+ * \file io/raw_iq.h
+ * \brief The sample formats of raw IQ files, which contain nothing but interleaved I and Q samples.
+ */
+
+
+/**
+ * \brief The formats of the samples in a raw IQ file.
+ *
+ * The names follow the usual file extensions of SDR tools. The samples are stored in the byte order of the machine.
+ */
+enum RawIqFormat {
+	RAW_IQ_CU8,		///< Unsigned 8 bit integers with their zero at 127.5, as written by rtl_sdr
+	RAW_IQ_CS8,		///< Signed 8 bit integers, as written by hackrf_transfer
+	RAW_IQ_CS16,	///< Signed 16 bit integers
+	RAW_IQ_CF32		///< 32 bit floating point numbers, as written by GNU Radio
+};
+
+
+/**
+ * \brief Get the size of a sample.
+ * \param format The format of the samples.
+ * \returns The number of bytes of the I or the Q part of one sample.
+ */
+inline size_t RawIqSampleSize(RawIqFormat format)
+{
+	switch (format) {
+	case RAW_IQ_CU8:
+	case RAW_IQ_CS8:  return 1;
+	case RAW_IQ_CS16: return 2;
+	case RAW_IQ_CF32: return 4;
+	}
+	BOOST_ASSERT_MSG(false, "Unknown raw IQ format!");
+	return 1;
+}
+
+
+/**
+ * \brief Get the value of a full scale sample.
+ * \param format The format of the samples.
+ * \returns The distance of the largest sample from zero, which corresponds to an amplitude of 1.
+ */
+inline Real RawIqFullScale(RawIqFormat format)
+{
+	switch (format) {
+	case RAW_IQ_CU8:  return Real(127.5);
+	case RAW_IQ_CS8:  return Real(127);
+	case RAW_IQ_CS16: return Real(32767);
+	case RAW_IQ_CF32: return Real(1);
+	}
+	BOOST_ASSERT_MSG(false, "Unknown raw IQ format!");
+	return Real(1);
+}
+
+
+#endif //IO_RAW_IQ_H_
@@ -6,8 +6,44 @@
 #include <fstream>
 #include <vector>
 #include <cstring>
+#include <memory>
+#include <string>
+#include <algorithm>
 #include <boost/assert.hpp>
 #include <utils.h>
+#include <io/input_file.h>
+#include <io/output_file.h>
+
+
+/**
+ * \brief The formats of the samples in a WAVE file.
+ */
+enum RiffWaveFormat : uint16_t {
+	RIFF_WAVE_PCM        = 0x0001,	///< Signed integers with 8, 16, 24 or 32 bits per sample (WAVE_FORMAT_PCM)
+	RIFF_WAVE_IEEE_FLOAT = 0x0003,	///< Floating point numbers with 32 or 64 bits per sample (WAVE_FORMAT_IEEE_FLOAT)
+	RIFF_WAVE_EXTENSIBLE = 0xFFFE	///< The format is given by the first two bytes of the sub format in the extension of the format header (WAVE_FORMAT_EXTENSIBLE)
+};
+
+
+/**
+ * \brief The container formats of WAVE files.
+ */
+enum RiffWaveContainer {
+	RIFF_WAVE_RIFF,		///< The classic RIFF container. Its 32 bit chunk sizes limit the file to 4 GB.
+	RIFF_WAVE_RF64,		///< The RF64 container of EBU Tech 3306, which stores the 64 bit sizes in a ds64 chunk
+	RIFF_WAVE_W64		///< The Sony Wave64 container, which identifies its chunks by GUIDs and has 64 bit chunk sizes
+};
+
+
+/**
+ * \brief The position of a chunk in a WAVE file.
+ */
+struct RiffWaveChunk
+{
+	std::string id;		///< The four character code of the chunk. For Wave64 files, these are the first four bytes of its GUID, e.g. `fmt ` or `data`.
+	uint64_t offset;	///< The position of the contents of the chunk in the file
+	uint64_t size;		///< The number of bytes of the contents of the chunk, without padding
+};
 
 
 /**
@@ -19,34 +55,31 @@ class RIFFWaveStream
 {
 	#pragma pack(push, 1)
 	/**
-	 * \brief The format header of a WAVE file.
+	 * \brief The contents of the format chunk of a WAVE file.
 	 */
 	struct FMTHeader
 	{
-		uint32_t _RIFF            = 0x46464952;		///< Filetype identification magic number (RIFF in ASCII)
-		uint32_t FileSize         = 0x00000000;		///< The size of the file starting from now on
-		uint32_t _WAVE            = 0x45564157;		///< Filetype indentification magic number (WAVE in ASCII)
-		uint32_t _fmt             = 0x20746D66;		///< The official start of the format header
-		uint32_t FormatDataLength = 0x00000010;		///< The length of the format header
-		uint16_t FormatType       = 0x0001;			///< The format type (Only type 1 is currently supported)
+		uint16_t FormatType       = 0x0001;			///< The format type (See \ref RiffWaveFormat)
 		uint16_t ChannelCount     = 0x0002;			///< The number of channels stored in the file
 		uint32_t FrameRate        = 0x0000AC44;		///< The number of frames per second (A frame is a collection of one sample for every channel)
 		uint32_t ByteRate         = 0x0002B110;		///< The byte rate of the file
 		uint16_t BytesPerFrame    = 0x0002;			///< The number of bytes per frame
-		uint16_t BitsPerSample    = 0x0010;			///< The number of bits per sample (Only 8 and 16 are currently supported)
+		uint16_t BitsPerSample    = 0x0010;			///< The number of bits per sample
 
 
 		/**
 		 * \brief Load the header from a given file
-		 * \param file The file to read the header from.
+		 * \param file The file to read the header from. It has to be positioned at the start of the contents of the format chunk.
+		 * \param size The size of the format chunk. All of it is consumed.
+		 * \returns The format of the samples. This is the sub format for \ref RIFF_WAVE_EXTENSIBLE and \ref FormatType otherwise.
 		 */
-		void load(std::ifstream& file);
+		uint16_t load(InputFile& file, uint64_t size);
 
 		/**
-		 * \brief Write the header to a given file
-		 * \param file The file to write the header to.
+		 * \brief Append the header to the bytes of the headers of a file
+		 * \param header The bytes to append the little endian header to.
 		 */
-		void save(std::ofstream& file);
+		void save(std::vector<uint8_t>& header) const;
 
 		/**
 		 * \brief toggle the endianness of every number stored in the header
@@ -55,40 +88,18 @@ class RIFFWaveStream
 	};
 	#pragma pack(pop)
 
-	#pragma pack(push, 1)
-	/**
-	 * \brief The data header of a WAVE file.
-	 */
-	struct DataHeader
-	{
-		uint32_t _data    = 0x61746164;		///< The start of the data header
-		uint32_t DataSize = 0x00000000;		///< The size of the data header
-
-		/**
-		 * \brief Load the header from a given file
-		 * \param file The file to read the header from.
-		 */
-		void load(std::ifstream& file);
-
-		/**
-		* \brief Write the header to a given file
-		* \param file The file to write the header to.
-		*/
-		void save(std::ofstream& file);
-
-		/**
-		* \brief toggle the endianness of every number stored in the header
-		*/
-		void toggleEndianness();
-	};
-	#pragma pack(pop)
-
 public:
 	/**
 	 * \brief Get the file size
 	 * \returns The Size of the WAVE file
 	 */
-	uint32_t FileSize() const;
+	uint64_t FileSize() const;
+
+	/**
+	 * \brief Get the container format
+	 * \returns The container the file is stored in
+	 */
+	RiffWaveContainer Container() const;
 
 	/**
 	 * \brief Get the format type
@@ -96,6 +107,12 @@ public:
 	 */
 	uint16_t FormatType() const;
 
+	/**
+	 * \brief Get the format of the samples
+	 * \returns Either \ref RIFF_WAVE_PCM or \ref RIFF_WAVE_IEEE_FLOAT for supported files. For \ref RIFF_WAVE_EXTENSIBLE files, this is the sub format.
+	 */
+	uint16_t SampleFormat() const;
+
 	/**
 	 * \brief Get the number of channels
 	 * \returns The number of channels of the WAVE file
@@ -120,17 +137,23 @@ public:
 	 */
 	uint16_t BitsPerSample() const;
 
+	/**
+	 * \brief Get the number of bytes per frame
+	 * \returns The number of bytes of one sample of every channel
+	 */
+	uint16_t BytesPerFrame() const;
+
 	/**
 	 * \brief Get the maximum value of a sample
-	 * \returns The maximal value of a sample using the current number of bits per sample
+	 * \returns The maximal value of an integer sample using the current number of bits per sample
 	 */
-	uint16_t MaxSampleValue() const;
+	uint32_t MaxSampleValue() const;
 
 	/**
 	 * \brief Get the number of frames
 	 * \returns The number of frames of the WAVE file
 	 */
-	uint32_t FrameCount() const;
+	uint64_t FrameCount() const;
 
 protected:
 	/**
@@ -139,12 +162,23 @@ protected:
 	RIFFWaveStream();
 
 	FMTHeader fmt_header;		///< The format header of this WAVE file
-	DataHeader data_header;		///< The data header of this WAVE file
+	RiffWaveContainer container = RIFF_WAVE_RIFF;	///< The container format of this WAVE file
+	uint64_t file_size = 0;		///< The size of the whole file in bytes
+	uint64_t data_size = 0;		///< The size of the data chunk in bytes
+	uint16_t sample_format = RIFF_WAVE_PCM;	///< The format of the samples, see \ref SampleFormat()
 };
 
 
 /**
  * \brief A WAVE output stream to a file
+ *
+ * The frames are collected in the large buffer of an \ref OutputFile and written in big chunks.
+ * New files use 16 bits per sample. They are written as \ref RIFF_WAVE_RIFF files, unless they grow beyond
+ * the 4 GB the 32 bit sizes can describe. Then the JUNK chunk reserved in front of the format chunk is
+ * turned into the ds64 chunk of a \ref RIFF_WAVE_RF64 file when the file is closed.
+ *
+ * A stream to a file descriptor, e.g. the standard output, can't go back to update the headers. Its headers are
+ * written in front of the first frame with the sizes set to 0xFFFFFFFF, which tells readers to take the data up to the end.
  */
 class RIFFWaveOStream : public RIFFWaveStream
 {
@@ -153,16 +187,28 @@ public:
 	 * \brief Constructor
 	 * \param path The path to the file to stream the data to
 	 * \param channel_count The number of channels of the WAVE file
+	 * \param mode The way the data is written to the file. This defaults to \ref FILE_WRITE_BUFFERED.
 	 */
-	RIFFWaveOStream(const std::string& path, uint16_t channel_count);
+	RIFFWaveOStream(const std::string& path, uint16_t channel_count, FileWriteMode mode = FILE_WRITE_BUFFERED);
 
 	/**
 	 * \brief Constructor
 	 * \param path The path to the file to stream the data to
 	 * \param sample_rate The number of samples per second of the final file
 	 * \param channel_count The number of channels of the WAVE file
+	 * \param mode The way the data is written to the file. This defaults to \ref FILE_WRITE_BUFFERED.
 	 */
-	RIFFWaveOStream(const std::string& path, uint32_t sample_rate, uint16_t channel_count);
+	RIFFWaveOStream(const std::string& path, uint32_t sample_rate, uint16_t channel_count, FileWriteMode mode = FILE_WRITE_BUFFERED);
+
+	/**
+	 * \brief Constructor
+	 * \param descriptor The file descriptor to stream the data to, e.g. \ref StandardOutput. It is not closed by this class.
+	 *                   The headers are written with the first frame, so the format has to be set before.
+	 * \param sample_rate The number of samples per second of the stream
+	 * \param channel_count The number of channels of the WAVE stream
+	 * \param mode The way the data is written to the file descriptor. This defaults to \ref FILE_WRITE_BUFFERED.
+	 */
+	RIFFWaveOStream(int descriptor, uint32_t sample_rate, uint16_t channel_count, FileWriteMode mode = FILE_WRITE_BUFFERED);
 
 	/**
 	 * \brief Destructor
@@ -174,10 +220,23 @@ public:
 
 	/**
 	 * \brief Output stream operator
+	 *
+	 * With 8 bits per sample, the samples have to be in `[-128, 127]` and are stored offset binary, i.e. shifted by 128.
+	 *
 	 * \param sample a pointer to an array of \ref ChannelCount() samples.
 	 */
 	RIFFWaveOStream& operator<<(int16_t* sample);
 
+	/**
+	 * \brief Append frames to the file
+	 *
+	 * The frames have to be stored as in the file, i.e. the samples of all channels interleaved, with the current number of bits per sample.
+	 *
+	 * \param count The number of frames to append.
+	 * \returns A pointer to `count * BytesPerFrame()` bytes, which have to be filled before the next write.
+	 */
+	uint8_t* appendFrames(uint32_t count);
+
 	/**
 	 * \brief Close the file.
 	 */
@@ -200,10 +259,31 @@ public:
 	 */
 	void set16BitsPerSample();
 
+	/**
+	 * \brief Write a \ref RIFF_WAVE_RF64 file, even if it is smaller than 4 GB
+	 *
+	 * Streams to a file descriptor are always \ref RIFF_WAVE_RIFF files.
+	 */
+	void setRf64();
+
+	/**
+	 * \brief Write a \ref RIFF_WAVE_W64 file
+	 *
+	 * The headers of a Wave64 file are longer, so this has to be called before the first frame is written.
+	 * Streams to a file descriptor are always \ref RIFF_WAVE_RIFF files.
+	 */
+	void setWave64();
+
 private:
-	std::ofstream file;		///< The file to stream all output to
+	OutputFile file;		///< The file to stream all output to
 
 
+	/**
+	 * \brief Get the position of the first frame in the file.
+	 * \returns The size of all headers in front of the data for the current container.
+	 */
+	uint64_t DataOffset() const;
+
 	/**
 	 * \brief Write the headers to the file.
 	 */
@@ -213,6 +293,13 @@ private:
 
 /**
  * \brief A WAVE input stream from file.
+ *
+ * The constructor walks through all chunks of the file and remembers their positions, so the format and data
+ * chunk are found between any other chunks, like LIST, fact or bext. The frames are read from the data chunk
+ * one block after the other, starting at any frame chosen with \ref seekFrame().
+ *
+ * A stream from a file descriptor, e.g. the standard input, is read up to the data chunk and can only be moved forwards.
+ * If its length is unknown, \ref FrameCount() is only correct once the end is reached.
  */
 class RIFFWaveIStream : public RIFFWaveStream
 {
@@ -220,23 +307,72 @@ public:
 	/**
 	 * \brief Constructor
 	 * \param path The path to the file to stream the data from.
+	 * \param mode The way the samples are read from the file. This defaults to \ref FILE_READ_STREAM.
+	 * \throws std::runtime_error If the file can't be opened.
+	 * \throws std::invalid_argument If the file is no WAVE file or lacks its format or data chunk.
 	 */
-	RIFFWaveIStream(const std::string& path);
+	RIFFWaveIStream(const std::string& path, FileReadMode mode = FILE_READ_STREAM);
 
 	/**
-	 * \brief Destructor
-	 *
-	 * Closes the input filestream.
+	 * \brief Constructor
+	 * \param descriptor The file descriptor to stream the data from, e.g. \ref StandardInput. It is not closed by this class.
+	 * \param mode The way the samples are read. A pipe can't be mapped, so \ref FILE_READ_MAPPED reads like \ref FILE_READ_STREAM.
+	 *             This defaults to \ref FILE_READ_STREAM.
+	 * \throws std::invalid_argument If the stream is no WAVE file or lacks its format or data chunk.
 	 */
-	~RIFFWaveIStream();
+	RIFFWaveIStream(int descriptor, FileReadMode mode = FILE_READ_STREAM);
 
 
 	/**
 	 * \brief Output stream operator
+	 *
+	 * After the end of the file, all samples are 0. Offset binary 8 bit samples are shifted by -128 into `[-128, 127]`.
+	 *
 	 * \param sample A pointer to an array of length ChannelCount()
 	 */
 	RIFFWaveIStream& operator>>(int16_t* sample);
 
+	/**
+	 * \brief Read the raw data of the next frames
+	 *
+	 * The frames are returned as stored in the file, i.e. the samples of all channels interleaved. In \ref FILE_READ_MAPPED mode
+	 * or after a call to \ref bufferAll(), the returned pointer points directly into the data and nothing is copied.
+	 *
+	 * \param count The number of frames to read. Is set to the number of frames actually read, which is less at the end of the file.
+	 * \returns A pointer to `count * BytesPerFrame()` bytes. It stays valid until the next read.
+	 */
+	const uint8_t* readFrames(uint32_t& count);
+
+	/**
+	 * \brief Read the raw data of the frames starting at a given frame
+	 *
+	 * This is \ref seekFrame() followed by \ref readFrames(uint32_t&), e.g. to read the time window of interest
+	 * or to split a file between workers, which each read their part through their own stream.
+	 *
+	 * \param offset The number of the first frame to read.
+	 * \param count The number of frames to read. Is set to the number of frames actually read, which is less at the end of the file.
+	 * \returns A pointer to `count * BytesPerFrame()` bytes. It stays valid until the next read.
+	 */
+	const uint8_t* readFrames(uint64_t offset, uint32_t& count);
+
+	/**
+	 * \brief Continue reading at a given frame
+	 * \param frame The number of the next frame to read. Positions after the end of the file are moved to the end.
+	 */
+	void seekFrame(uint64_t frame);
+
+	/**
+	 * \brief Get the read position
+	 * \returns The number of the next frame to read.
+	 */
+	uint64_t tellFrame() const;
+
+	/**
+	 * \brief Get all chunks of the file
+	 * \returns The chunks in the order they are stored in the file.
+	 */
+	const std::vector<RiffWaveChunk>& Chunks() const;
+
 	/**
 	 * \brief Test if EOF is reached
 	 */
@@ -245,25 +381,57 @@ public:
 	/**
 	 * \brief buffer the whole data in RAM
 	 *
-	 * This stores the data as a `std::vector` of `int16_t`. So if the original file
-	 * uses 8 bits per sample, the size doubles when buffered with this method!
+	 * This copies the data as stored in the file into a `std::vector` and starts reading from the first frame again.
+	 * Reading a file in \ref FILE_READ_MAPPED mode is usually the better option, because the OS then loads and
+	 * evicts the pages as needed without a second copy in memory.
 	 */
 	void bufferAll();		//Buffer the whole file
 
 private:
-	std::ifstream file;		///< The input filestream to read the data from
+	/**
+	 * \brief Walk through the chunks of a WAVE file of any container.
+	 * \param file The file positioned at its start.
+	 * \returns The position of the first frame in the file.
+	 */
+	uint64_t readHeaders(InputFile& file);
 
-	std::vector<int16_t> file_buffer;	///< This vector contains the buffered input data
+	/**
+	 * \brief Walk through the chunks of a RIFF or RF64 file.
+	 * \param file The file positioned after the 4 byte file type.
+	 * \param rf64 Wether the file type is RF64.
+	 * \returns The position of the first frame in the file.
+	 */
+	uint64_t readRiffHeaders(InputFile& file, bool rf64);
+
+	/**
+	 * \brief Walk through the chunks of a Wave64 file.
+	 * \param file The file positioned after the GUID of the riff chunk.
+	 * \returns The position of the first frame in the file.
+	 */
+	uint64_t readWave64Headers(InputFile& file);
+
+	std::vector<RiffWaveChunk> chunks;	///< All chunks of the file
+
+	std::unique_ptr<InputFile> data;	///< The data chunk of the file, or the whole stream of a file descriptor
+	uint64_t data_start = 0;			///< The position of the first frame in \ref data
+
+	std::vector<uint8_t> file_buffer;	///< This vector contains the buffered input data
 	bool file_buffered = false;			///< Saves wether the file is currently buffered
-	uint32_t index = 0;					///< The number of the next frame to output
+	uint64_t index = 0;					///< The number of the next frame to output
 };
 
 
 //---------- inline /templated functions implementation ----------//
 
-inline uint32_t RIFFWaveStream::FileSize() const
+inline uint64_t RIFFWaveStream::FileSize() const
+{
+	return file_size;
+}
+
+
+inline RiffWaveContainer RIFFWaveStream::Container() const
 {
-	return fmt_header.FileSize + 8;
+	return container;
 }
 
 
@@ -297,15 +465,27 @@ inline uint16_t RIFFWaveStream::BitsPerSample() const
 }
 
 
-inline uint16_t RIFFWaveStream::MaxSampleValue() const
+inline uint16_t RIFFWaveStream::BytesPerFrame() const
 {
-	return ((1 << fmt_header.BitsPerSample) - 1) / 2;
+	return fmt_header.BytesPerFrame;
 }
 
 
-inline uint32_t RIFFWaveStream::FrameCount() const
+inline uint16_t RIFFWaveStream::SampleFormat() const
 {
-	return data_header.DataSize / fmt_header.BytesPerFrame;
+	return sample_format;
+}
+
+
+inline uint32_t RIFFWaveStream::MaxSampleValue() const
+{
+	return static_cast<uint32_t>((uint64_t(1) << (fmt_header.BitsPerSample - 1)) - 1);
+}
+
+
+inline uint64_t RIFFWaveStream::FrameCount() const
+{
+	return data_size / fmt_header.BytesPerFrame;
 }
 
 
@@ -315,39 +495,82 @@ inline uint32_t RIFFWaveStream::FrameCount() const
 inline RIFFWaveOStream& RIFFWaveOStream::operator<<(int16_t* sample)
 {
 	if (fmt_header.BitsPerSample == 8) {
-		std::vector<uint8_t> data(fmt_header.ChannelCount, 0);
+		uint8_t* data = appendFrames(1);
 		for (uint16_t channel = 0; channel < fmt_header.ChannelCount; ++channel)
-			data[channel] = (uint8_t)(sample[channel] & 0x00FF);
-		file.write(reinterpret_cast<const char*>(data.data()), fmt_header.ChannelCount);
+			data[channel] = (uint8_t)(sample[channel] + 128);
 	}
 	else {
-		file.write(reinterpret_cast<const char*>(sample), fmt_header.ChannelCount * sizeof(*sample));
+		memcpy(appendFrames(1), sample, fmt_header.ChannelCount * sizeof(*sample));
 	}
 	return *this;
 }
 
 
+inline uint8_t* RIFFWaveOStream::appendFrames(uint32_t count)
+{
+	//Only a stream to a file descriptor starts without headers
+	if (file.Position() == 0)
+		writeHeaders();
+	return file.Append(static_cast<size_t>(count) * fmt_header.BytesPerFrame);
+}
+
+
 
 //---------- RIFFWaveIStream Implementation ----------//
 
 inline RIFFWaveIStream& RIFFWaveIStream::operator>>(int16_t* sample)
 {
-	BOOST_ASSERT_MSG(BitsPerSample() == 8 || BitsPerSample() == 16, "The file must have either 8 or 16 bits per sample!");
+	BOOST_ASSERT_MSG(SampleFormat() == RIFF_WAVE_PCM && (BitsPerSample() == 8 || BitsPerSample() == 16), "The file must have either 8 or 16 bits per sample!");
+	uint32_t count = 1;
+	const uint8_t* bytes = readFrames(count);
+	for (uint16_t channel = 0; channel < ChannelCount(); ++channel) {
+		if (count == 0)
+			sample[channel] = 0;
+		else if (BitsPerSample() == 8)
+			sample[channel] = static_cast<int16_t>(bytes[channel]) - 128;
+		else if (BitsPerSample() == 16)
+			memcpy(sample + channel, bytes + 2 * channel, sizeof(*sample));
+	}
+	return *this;
+}
+
+
+inline const uint8_t* RIFFWaveIStream::readFrames(uint32_t& count)
+{
+	count = static_cast<uint32_t>(std::min<uint64_t>(count, FrameCount() - std::min(index, FrameCount())));
+	const uint8_t* bytes;
 	if (file_buffered)
-		memcpy(sample, &(file_buffer[index * ChannelCount()]), sizeof(*sample) * ChannelCount());
+		bytes = file_buffer.data() + static_cast<size_t>(index) * BytesPerFrame();
 	else {
-		//Read all bytes for this frame
-		std::vector<uint8_t> bytes(fmt_header.BytesPerFrame);
-		file.read((char*)bytes.data(), bytes.size());
-		for (uint16_t channel = 0; channel < ChannelCount(); ++channel) {
-			if (BitsPerSample() == 8)
-				sample[channel] = signextend<uint16_t, 8>(bytes[channel]);
-			else if (BitsPerSample() == 16)
-				sample[channel] = *(int16_t*)&bytes[2 * channel];
-		}
+		const size_t requested = static_cast<size_t>(count) * BytesPerFrame();
+		size_t size = requested;
+		bytes = data->Read(size);
+		count = static_cast<uint32_t>(size / BytesPerFrame());
+		//The length of a stream is only known once its end is reached
+		if (size < requested)
+			data_size = (index + count) * BytesPerFrame();
 	}
-	++index;
-	return *this;
+	index += count;
+	return bytes;
+}
+
+
+inline const uint8_t* RIFFWaveIStream::readFrames(uint64_t offset, uint32_t& count)
+{
+	seekFrame(offset);
+	return readFrames(count);
+}
+
+
+inline uint64_t RIFFWaveIStream::tellFrame() const
+{
+	return index;
+}
+
+
+inline const std::vector<RiffWaveChunk>& RIFFWaveIStream::Chunks() const
+{
+	return chunks;
 }
 
 
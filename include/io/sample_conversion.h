@@ -0,0 +1,78 @@
+#ifndef IO_SAMPLE_CONVERSION_H_
+#define IO_SAMPLE_CONVERSION_H_
+
+#include <types.h>
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * \file io/sample_conversion.h
+ * \brief Conversion between the interleaved integer samples stored in files and the \ref Real signals of the filters.
+ */
+
+
+/**
+ * \brief A signed 24 bit integer sample as stored in a file, i.e. three bytes with the least significant one first.
+ */
+struct Pcm24 {
+	uint8_t bytes[3];	///< The bytes of the sample
+};
+
+
+/**
+ * \brief Convert interleaved samples to \ref Real and split them into one array per channel.
+ *
+ * Calculates `out[channel][i] = scale * samples[i * channel_count + channel]` for every frame `i` in `[0, count)`.
+ * For one and two channels, a whole SIMD register of frames is loaded, split into the channels and converted at once.
+ * One channel of samples of type \ref Real with a scale of 1 is just copied.
+ * The samples are expected in the byte order of the machine. Unsigned samples are offset binary, so the middle of
+ * their range is subtracted before scaling, e.g. 127.5 for `uint8_t`.
+ *
+ * \tparam Tsample The type of the samples in the file. Has to be one of `uint8_t`, `int8_t`, `int16_t`, \ref Pcm24, `int32_t`, `float` or `double`.
+ * \param bytes The interleaved samples.
+ * \param count The number of frames to convert.
+ * \param channel_count The number of samples per frame.
+ * \param scale The factor to multiply every sample with.
+ * \param out An array of `channel_count` pointers to arrays of at least `count` elements receiving the samples of each channel.
+ */
+template<typename Tsample>
+void DeinterleaveSamples(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out);
+
+/**
+ * \brief A pointer to one of the versions of \ref DeinterleaveSamples(), e.g. to choose the conversion once per file.
+ */
+using DeinterleaveFunction = void (*)(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out);
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void DeinterleaveSamples<Pcm24>(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out);
+///\endcond
+
+
+/**
+ * \brief Quantise \ref Real samples to integers and interleave the channels.
+ *
+ * Calculates `samples[i * channel_count + channel] = round(scale * in[channel][i])` for every frame `i` in `[0, count)`.
+ * Values outside the range of `Tsample` are saturated to its minimum or maximum instead of wrapping around.
+ * Unsigned samples are offset binary, so the middle of their range is added before rounding. Floating point samples are only scaled.
+ * For one and two channels, a whole SIMD register of frames is converted and interleaved at once.
+ * The samples are written in the byte order of the machine.
+ *
+ * \tparam Tsample The type of the samples in the file. Has to be one of `uint8_t`, `int8_t`, `int16_t`, `float` or `double`.
+ * \param in An array of `channel_count` pointers to arrays of at least `count` samples of each channel.
+ * \param count The number of frames to convert.
+ * \param channel_count The number of samples per frame.
+ * \param scale The factor to multiply every sample with before it is rounded.
+ * \param bytes The array of `count * channel_count * sizeof(Tsample)` bytes receiving the interleaved samples.
+ */
+template<typename Tsample>
+void InterleaveSamples(const Real* const* in, size_t count, uint16_t channel_count, Real scale, uint8_t* bytes);
+
+/**
+ * \brief A pointer to one of the versions of \ref InterleaveSamples(), e.g. to choose the conversion once per file.
+ */
+using InterleaveFunction = void (*)(const Real* const* in, size_t count, uint16_t channel_count, Real scale, uint8_t* bytes);
+
+
+#endif //IO_SAMPLE_CONVERSION_H_
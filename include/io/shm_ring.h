@@ -0,0 +1,145 @@
+#ifndef IO_SHM_RING_H_
+#define IO_SHM_RING_H_
+
+#include <types.h>
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+/**
+ * \brief The side of a \ref ShmRing a process is on.
+ */
+enum ShmRingSide {
+	SHM_RING_READER,	///< Drains the blocks with \ref ShmRing::PopFull() and \ref ShmRing::PushEmpty()
+	SHM_RING_WRITER		///< Fills the blocks with \ref ShmRing::PopEmpty() and \ref ShmRing::PushFull()
+};
+
+
+/**
+ * \brief The number of blocks of samples passed between filters, which make up one block of the \ref ShmRing
+ *        of a \ref ShmRingInput or \ref ShmRingOutput.
+ */
+constexpr size_t ShmRingSampleBlocks = 256;
+
+/**
+ * \brief Get the size of the blocks of the \ref ShmRing of a \ref ShmRingInput or \ref ShmRingOutput.
+ * \param channel_count The number of channels, i.e. 1 for \ref Real and 2 for \ref Complex samples.
+ * \returns The number of bytes of \ref ShmRingSampleBlocks blocks of samples.
+ */
+inline size_t ShmRingBlockSize(size_t channel_count)
+{
+	return ShmRingSampleBlocks * channel_count * RealSimd::static_size * sizeof(Real);
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+struct ShmRingHeader;
+///\endcond
+
+
+/**
+ * \brief A ring of fixed size blocks in named shared memory, passed from one process to another.
+ *
+ * Like a \ref ChunkQueue, one side fills the blocks and the other side drains them: The writer takes an empty
+ * block with \ref PopEmpty() and hands it over with \ref PushFull(), the reader takes it with \ref PopFull() and
+ * returns it with \ref PushEmpty(). The blocks are used strictly in turn, so the indices of the next blocks are
+ * atomic counters and no locks are needed. The functions wait for a block: The waiting side sleeps on a process
+ * shared semaphore, which only calls into the kernel if the ring is empty or full.
+ *
+ * Both sides open the ring by its name with the same geometry, whichever comes first creates it. The shared memory
+ * is removed when the last side closes it, so the reader has to be started before the writer finished.
+ * The name of a ring left behind by a crashed process can be freed with \ref Remove().
+ */
+class ShmRing
+{
+public:
+	static constexpr size_t Alignment = 64;	///< The alignment of every block, enough for all SIMD registers
+
+	/**
+	 * \brief Constructor
+	 * \param name The name of the shared memory. It must not contain any slashes.
+	 * \param block_size The number of bytes of every block. Has to be a multiple of \ref Alignment.
+	 * \param block_count The number of blocks in the ring.
+	 * \param side The side of the ring this process is on.
+	 */
+	ShmRing(const std::string& name, size_t block_size, size_t block_count, ShmRingSide side);
+
+	/**
+	 * \brief Destructor
+	 *
+	 * Calls \ref Close().
+	 */
+	~ShmRing();
+
+	ShmRing(const ShmRing&) = delete;
+	ShmRing& operator=(const ShmRing&) = delete;
+
+
+	/**
+	 * \brief Take an empty block to fill. Waits until the reader returned one.
+	 *
+	 * Only one block can be taken at a time.
+	 *
+	 * \returns A pointer to \ref BlockSize() aligned bytes, or `nullptr` if the reader closed the ring.
+	 */
+	uint8_t* PopEmpty();
+
+	/**
+	 * \brief Pass the block taken with \ref PopEmpty() on to the reader.
+	 * \param size The number of bytes at the start of the block which contain data.
+	 */
+	void PushFull(size_t size);
+
+	/**
+	 * \brief Take the oldest filled block. Waits until the writer passed one on.
+	 *
+	 * Only one block can be taken at a time.
+	 *
+	 * \param size Is set to the number of bytes in the block.
+	 * \returns A pointer to the aligned block, or `nullptr` if the writer closed the ring and all blocks are drained.
+	 */
+	const uint8_t* PopFull(size_t& size);
+
+	/**
+	 * \brief Return the block taken with \ref PopFull() to the writer.
+	 */
+	void PushEmpty();
+
+	/**
+	 * \brief Close this side of the ring.
+	 *
+	 * Once the writer closed the ring, the reader gets the remaining blocks and then the end of the data.
+	 * Once the reader closed it, the writer gets no more blocks. This is done by both sides on destruction.
+	 */
+	void Close();
+
+
+	/**
+	 * \brief Get the size of the blocks.
+	 * \returns The number of bytes of every block.
+	 */
+	size_t BlockSize() const;
+
+	/**
+	 * \brief Remove the name of a ring.
+	 *
+	 * Processes which have opened the ring keep using it, but the next ones opening the name get a new ring.
+	 *
+	 * \param name The name of the shared memory.
+	 */
+	static void Remove(const std::string& name);
+
+private:
+	const std::string name;								///< The name of the shared memory
+	const ShmRingSide side;								///< The side of the ring this process is on
+	boost::interprocess::managed_shared_memory segment;	///< The shared memory mapped into this process
+	ShmRingHeader* header;								///< The state of the ring shared by both sides
+	uint64_t* sizes;									///< The number of bytes filled in every block
+	uint8_t* blocks;									///< The aligned memory of all blocks
+	bool open = true;									///< Wether this side hasn't closed the ring yet
+};
+
+
+#endif //IO_SHM_RING_H_
@@ -0,0 +1,57 @@
+#ifndef TEST_TEST_ANALYTIC_SIGNAL_H_
+#define TEST_TEST_ANALYTIC_SIGNAL_H_
+
+#include <types.h>
+#include <filter/analytic_signal.h>
+#include <filter/vector_input.h>
+#include <filter/vector_output.h>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \file test/test_analytic_signal.h
+ * \brief This file contains tests for the \ref AnalyticSignal filter.
+ */
+
+
+/**
+ * \brief Test \ref AnalyticSignal<Real>
+ *
+ * The analytic signal of a cosine is a complex exponential delayed by the group delay of the filter.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestAnalyticSignal()
+{
+	const double sample_rate = 12000;
+	const double frequency = 2400;
+	const double omega = 2 * boost::math::constants::pi<double>() * frequency / sample_rate;
+	std::vector<Real> test_input(64 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = static_cast<Real>(std::cos(omega * i));
+	VectorInput<Real> input(sample_rate, test_input);
+	AnalyticSignal<Real> filter(sample_rate, 63);
+	VectorOutput<Complex> output(sample_rate);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&filter), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		output.Update();
+	}
+	const int delay = static_cast<int>(std::round(filter.GroupDelay() * sample_rate));
+	if (delay != 31)
+		return false;
+	//Skip the samples influenced by the initial zeros of the filter
+	for (int i = 2 * delay; i < (int)test_input.size(); ++i) {
+		const Complex expected(static_cast<Real>(std::cos(omega * (i - delay))), static_cast<Real>(std::sin(omega * (i - delay))));
+		if (std::abs(output.GetStored()[i] - expected) > 1e-2)
+			return false;
+	}
+	return true;
+}
+
+
+#endif //TEST_TEST_ANALYTIC_SIGNAL_H_
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef TEST_TEST_APT_DECODER_H_
+#define TEST_TEST_APT_DECODER_H_
+
+#include <types.h>
+#include <apt/apt_decoder.h>
+#include <filter/vector_input.h>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <string>
+#include <vector>
+
+
+/**
+ * \file test/test_apt_decoder.h
+ * \brief This file contains tests for the \ref AptDecoder.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+//The words of a synthetic APT line with a gradient in both images
+inline std::vector<Real> TestAptLine()
+{
+	const std::string sync_a = "000011001100110011001100110011000000000";
+	const std::string sync_b = "000011100111001110011100111001110011100";
+	std::vector<Real> line;
+	for (char c : sync_a)
+		line.push_back(c == '1' ? Real(1) : Real(0));
+	line.insert(line.end(), 47, Real(0));
+	for (int i = 0; i < 909; ++i)
+		line.push_back(Real(i) / 909);
+	line.insert(line.end(), 45, Real(0.5));
+	for (char c : sync_b)
+		line.push_back(c == '1' ? Real(1) : Real(0));
+	line.insert(line.end(), 47, Real(1));
+	for (int i = 0; i < 909; ++i)
+		line.push_back(1 - Real(i) / 909);
+	line.insert(line.end(), 45, Real(0.5));
+	return line;
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref AptDecoder
+ *
+ * A synthetic APT signal starting in the middle of a line has to be decoded into lines starting with sync A.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestAptDecoder()
+{
+	const double sample_rate = 11025;
+	const double offset = 1234.5;	//The word of the line at the start of the signal
+	const std::vector<Real> line = TestAptLine();
+	std::vector<Real> test_input(2048 * 8 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i) {
+		const double t = i / sample_rate;
+		const Real word = line[static_cast<size_t>(t * AptDecoder::WordRate + offset) % line.size()];
+		test_input[i] = static_cast<Real>((0.1 + 0.8 * word) * std::cos(boost::math::constants::two_pi<double>() * 2400 * t));
+	}
+	VectorInput<Real> input(sample_rate, test_input);
+	AptDecoder decoder(sample_rate);
+	decoder.SetInput({ static_cast<const Filter*>(&input), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		decoder.Update();
+	}
+	const size_t expected_lines = static_cast<size_t>(test_input.size() / sample_rate * AptDecoder::WordRate / AptDecoder::LineLength) - 2;
+	if (decoder.LineCount() < expected_lines)
+		return false;
+	for (size_t l = 0; l < decoder.LineCount(); ++l) {
+		Real error = 0;
+		for (size_t i = 0; i < AptDecoder::LineLength; ++i)
+			error += std::abs(decoder.Lines()[l * AptDecoder::LineLength + i] - Real(0.1 + 0.8 * line[i]));
+		if (error / AptDecoder::LineLength > 0.05)
+			return false;
+	}
+	return decoder.Image().size() == decoder.LineCount() * AptDecoder::LineLength;
+}
+
+
+#endif //TEST_TEST_APT_DECODER_H_
@@ -0,0 +1,165 @@
+#ifndef TEST_TEST_BATCH_FILTERS_H_
+#define TEST_TEST_BATCH_FILTERS_H_
+
+#include <types.h>
+#include <filter/batch_biquad_cascade.h>
+#include <filter/batch_differentiator.h>
+#include <filter/batch_fir.h>
+#include <filter/batch_frequency_shift.h>
+#include <filter/biquad_cascade.h>
+#include <filter/differentiator.h>
+#include <filter/fir.h>
+#include <filter/fir_design.h>
+#include <filter/frequency_shift.h>
+#include <filter/vector_input.h>
+#include <cmath>
+#include <complex>
+#include <type_traits>
+#include <vector>
+
+
+/**
+ * \file test/test_batch_filters.h
+ * \brief This file contains tests for the batched filters derived from \ref BatchFilter.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+//More than one group of channels, the last one only partially used
+constexpr size_t BatchTestChannels = RealSimd::static_size + 3;
+constexpr size_t BatchTestBlocks = 16;
+
+//A different signal for every channel
+inline std::vector<Real> BatchTestSignal(size_t channel, Real)
+{
+	std::vector<Real> signal(BatchTestBlocks * RealSimd::static_size);
+	for (size_t i = 0; i < signal.size(); ++i)
+		signal[i] = std::sin(Real(0.1) * (channel + 1) * i) + (i % (channel + 3) == 0 ? Real(0.5) : Real(0));
+	return signal;
+}
+
+inline std::vector<Complex> BatchTestSignal(size_t channel, Complex)
+{
+	std::vector<Complex> signal(BatchTestBlocks * RealSimd::static_size);
+	for (size_t i = 0; i < signal.size(); ++i)
+		signal[i] = std::polar(Real(1) / (channel + 1), Real(0.05) * (channel + 1) * i) + (i % (channel + 3) == 0 ? Complex(0, 0.5) : Complex(0));
+	return signal;
+}
+
+inline bool CloseTo(Real a, Real b)
+{
+	return std::abs(a - b) <= Real(1e-4) * (1 + std::abs(b));
+}
+
+//The filters hold SIMD packs, so they are kept in aligned memory. Reserving up front keeps them from being moved once connected.
+template<typename T>
+using BatchTestFilters = AlignedStdVec<T, RealSimd::alignment>;
+
+//Run every channel through the batched filter and through its own single channel filter and compare the outputs
+template<typename Tin, typename TSingle>
+bool CompareBatchFilter(BatchFilter<Tin>& batch, BatchTestFilters<TSingle>& single, bool complex_output)
+{
+	BatchTestFilters<VectorInput<Tin>> inputs;
+	inputs.reserve(BatchTestChannels);
+	for (size_t c = 0; c < BatchTestChannels; ++c) {
+		const std::vector<Tin> signal = BatchTestSignal(c, Tin());
+		inputs.emplace_back(batch.SampleRateIn(), signal);
+		batch.SetInput(c, { static_cast<const Filter*>(&inputs[c]), 0 });
+		single[c].SetInput(0, { static_cast<const Filter*>(&inputs[c]), 0 });
+	}
+	bool success = true;
+	for (size_t block = 0; block < BatchTestBlocks; ++block) {
+		for (auto& input : inputs)
+			input.Update();
+		batch.Update();
+		for (size_t c = 0; c < BatchTestChannels; ++c) {
+			single[c].Update();
+			for (size_t i = 0; i < RealSimd::static_size; ++i) {
+				if (complex_output) {
+					success = success && CloseTo(batch.GetComplex(c).first[i], single[c].GetComplex(0).first[i])
+						&& CloseTo(batch.GetComplex(c).second[i], single[c].GetComplex(0).second[i]);
+				}
+				else
+					success = success && CloseTo(batch.GetReal(c)[i], single[c].GetReal(0)[i]);
+			}
+		}
+	}
+	return success;
+}
+
+template<typename Tin>
+bool TestBatchFilters()
+{
+	constexpr double sample_rate = 8000;
+	const bool complex_output = std::is_same<Tin, Complex>::value;
+	bool success = true;
+
+	std::vector<BiquadSection> sections = BiquadSection::ButterworthLowPass(sample_rate, 1000, 4);
+	BatchBiquadCascade<Tin> biquad(sample_rate, BatchTestChannels, sections);
+	BatchTestFilters<BiquadCascade<Tin>> biquad_single;
+	biquad_single.reserve(BatchTestChannels);
+	for (size_t c = 0; c < BatchTestChannels; ++c)
+		biquad_single.emplace_back(sample_rate, sections);
+	success = CompareBatchFilter(biquad, biquad_single, complex_output) && success;
+	success = success && biquad.GroupDelay() == biquad_single[0].GroupDelay();
+
+	const std::vector<Real> coeff = LowPassCoefficients(sample_rate, 1500, 11, Hamming);
+	BatchFir<Tin> fir(sample_rate, BatchTestChannels, coeff);
+	BatchTestFilters<Fir<Tin>> fir_single;
+	fir_single.reserve(BatchTestChannels);
+	for (size_t c = 0; c < BatchTestChannels; ++c)
+		fir_single.emplace_back(sample_rate, coeff);
+	success = CompareBatchFilter(fir, fir_single, complex_output) && success;
+	success = success && std::abs(fir.GroupDelay() - 5 / sample_rate) < 1e-9;
+
+	BatchDifferentiator<Tin> differentiator(sample_rate, BatchTestChannels);
+	BatchTestFilters<Differentiator<Tin>> differentiator_single;
+	differentiator_single.reserve(BatchTestChannels);
+	for (size_t c = 0; c < BatchTestChannels; ++c)
+		differentiator_single.emplace_back(sample_rate);
+	success = CompareBatchFilter(differentiator, differentiator_single, complex_output) && success;
+
+	std::vector<Real> shifts;
+	BatchTestFilters<FrequencyShift<Tin>> shift_single;
+	shift_single.reserve(BatchTestChannels);
+	for (size_t c = 0; c < BatchTestChannels; ++c) {
+		shifts.push_back(Real(150) * c - 600);
+		shift_single.emplace_back(sample_rate, shifts.back());
+	}
+	BatchFrequencyShift<Tin> shift(sample_rate, shifts);
+	success = CompareBatchFilter(shift, shift_single, true) && success;
+
+	return success;
+}
+///\endcond
+
+
+/**
+ * \brief Test the batched filters with \ref Real input
+ *
+ * \ref BatchBiquadCascade<Real>, \ref BatchFir<Real>, \ref BatchDifferentiator<Real> and \ref BatchFrequencyShift<Real>
+ * filter more channels than fit into one SIMD register. Every channel has to match a \ref BiquadCascade<Real>,
+ * \ref Fir<Real>, \ref Differentiator<Real> or \ref FrequencyShift<Real> filtering only this channel.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestBatchFiltersReal()
+{
+	return TestBatchFilters<Real>();
+}
+
+
+/**
+ * \brief Test the batched filters with \ref Complex input
+ *
+ * Like \ref TestBatchFiltersReal(), but with \ref Complex signals.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestBatchFiltersComplex()
+{
+	return TestBatchFilters<Complex>();
+}
+
+
+#endif //TEST_TEST_BATCH_FILTERS_H_
@@ -0,0 +1,149 @@
+#ifndef TEST_TEST_BIQUAD_CASCADE_H_
+#define TEST_TEST_BIQUAD_CASCADE_H_
+
+#include <types.h>
+#include <filter/biquad_cascade.h>
+#include <filter/vector_input.h>
+#include <filter/vector_output.h>
+#include <boost/math/constants/constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+
+/**
+ * \file test/test_biquad_cascade.h
+ * \brief This file contains tests for the \ref BiquadCascade filter.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+inline std::vector<Real> BiquadReference(const std::vector<BiquadSection>& sections, std::vector<Real> samples)
+{
+	for (const BiquadSection& c : sections) {
+		Real s1 = 0, s2 = 0;
+		for (Real& x : samples) {
+			const Real y = c.b0 * x + s1;
+			s1 = c.b1 * x - c.a1 * y + s2;
+			s2 = c.b2 * x - c.a2 * y;
+			x = y;
+		}
+	}
+	return samples;
+}
+
+//The phase of the frequency response of the sections at a normalized frequency
+inline double BiquadPhase(const std::vector<BiquadSection>& sections, double frequency_norm)
+{
+	const std::complex<double> z1 = std::polar(1.0, -boost::math::constants::two_pi<double>() * frequency_norm);
+	std::complex<double> response(1);
+	for (const BiquadSection& c : sections)
+		response *= (c.b0 + c.b1 * z1 + c.b2 * z1 * z1) / (1.0 + c.a1 * z1 + c.a2 * z1 * z1);
+	return std::arg(response);
+}
+
+//The group delay of a band pass has to be finite and within the range of the delays over its pass band
+inline bool CheckBandPassGroupDelay(const std::vector<BiquadSection>& sections, double low_norm, double high_norm)
+{
+	const double delay = BiquadSection::GroupDelay(sections);
+	if (!std::isfinite(delay))
+		return false;
+	double min_delay = 1e9, max_delay = -1e9;
+	const double step = 1e-5;
+	for (double f = low_norm; f <= high_norm; f += (high_norm - low_norm) / 64) {
+		double difference = BiquadPhase(sections, f + step) - BiquadPhase(sections, f - step);
+		difference = std::remainder(difference, boost::math::constants::two_pi<double>());
+		const double measured = -difference / (2 * step * boost::math::constants::two_pi<double>());
+		min_delay = std::min(min_delay, measured);
+		max_delay = std::max(max_delay, measured);
+	}
+	return delay >= min_delay - 1e-3 && delay <= max_delay + 1e-3;
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref BiquadCascade<Real>
+ *
+ * Compares the block state space implementation to the sample by sample recursion.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestBiquadCascadeReal()
+{
+	std::vector<BiquadSection> sections = BiquadSection::ButterworthLowPass(8000, 1000, 5);
+	std::vector<BiquadSection> notch = BiquadSection::Notch(8000, 50, 10);
+	sections.insert(sections.end(), notch.begin(), notch.end());
+	std::vector<Real> test_input(64);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = std::sin(Real(0.7) * i) + (i % 5 == 0 ? Real(1) : Real(0));
+	std::vector<Real> expected_output = BiquadReference(sections, test_input);
+	VectorInput<Real> input(8000, test_input);
+	BiquadCascade<Real> filter(8000, sections);
+	VectorOutput<Real> output(8000);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&filter), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		output.Update();
+	}
+	for (int i = 0; i < (int)expected_output.size(); ++i)
+		if (std::abs(output.GetStored()[i] - expected_output[i]) > 1e-4)
+			return false;
+	return true;
+}
+
+
+/**
+ * \brief Test \ref BiquadCascade<Complex>
+ *
+ * A Chebyshev low pass filter of even order has to settle at the bottom of its ripple band for a constant input.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestBiquadCascadeComplex()
+{
+	const Real ripple = 1;
+	std::vector<Complex> test_input(4 * RealSimd::static_size, Complex(1, -2));
+	VectorInput<Complex> input(1000, test_input);
+	BiquadCascade<Complex> filter(1000, BiquadSection::ChebyshevLowPass(1000, 100, 4, ripple));
+	VectorOutput<Complex> output(1000);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&filter), 0 });
+	for (int i = 0; i < 1000; ++i) {
+		input.Update();
+		filter.Update();
+		output.Update();
+	}
+	const Real dc_gain = Real(1) / std::sqrt(std::pow(Real(10), ripple / 10));
+	return std::abs(output.GetStored().back() - dc_gain * Complex(1, -2)) < 1e-4;
+}
+
+
+/**
+ * \brief Test the group delay of band pass cascades
+ *
+ * Cascades blocking both DC and the nyquist frequency, like a \ref BiquadSection::DcBlocker followed by a
+ * \ref BiquadSection::ButterworthLowPass, have to report a finite group delay within the range of the group delay
+ * measured over their pass band.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestBiquadCascadeGroupDelay()
+{
+	std::vector<BiquadSection> dc_blocked = BiquadSection::DcBlocker(8000, 20);
+	std::vector<BiquadSection> low_pass = BiquadSection::ButterworthLowPass(8000, 1000, 4);
+	dc_blocked.insert(dc_blocked.end(), low_pass.begin(), low_pass.end());
+	std::vector<BiquadSection> band_pass = BiquadSection::ButterworthHighPass(8000, 500, 2);
+	low_pass = BiquadSection::ButterworthLowPass(8000, 1500, 2);
+	band_pass.insert(band_pass.end(), low_pass.begin(), low_pass.end());
+	BiquadCascade<Real> filter(8000, band_pass);
+	return CheckBandPassGroupDelay(dc_blocked, 100.0 / 8000, 900.0 / 8000)
+		&& CheckBandPassGroupDelay(band_pass, 500.0 / 8000, 1500.0 / 8000)
+		&& std::abs(filter.GroupDelay() * 8000 - BiquadSection::GroupDelay(band_pass)) < 1e-9;
+}
+
+
+#endif //TEST_TEST_BIQUAD_CASCADE_H_
\ No newline at end of file
@@ -0,0 +1,107 @@
+#ifndef TEST_TEST_CORRELATOR_H_
+#define TEST_TEST_CORRELATOR_H_
+
+#include <types.h>
+#include <filter/correlator.h>
+#include <filter/vector_input.h>
+#include <filter/vector_output.h>
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \file test/test_correlator.h
+ * \brief This file contains tests for the \ref Correlator.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+//A pseudo random pattern of +-1 and a noisy signal containing it at the given positions
+inline std::vector<Real> TestCorrelatorPattern(size_t length)
+{
+	std::vector<Real> pattern(length);
+	uint32_t state = 12345;
+	for (Real& x : pattern) {
+		state = state * 1103515245 + 12345;
+		x = (state >> 16) & 1 ? Real(1) : Real(-1);
+	}
+	return pattern;
+}
+
+inline std::vector<Real> TestCorrelatorSignal(const std::vector<Real>& pattern, const std::vector<size_t>& positions, size_t length)
+{
+	std::vector<Real> signal(length);
+	for (size_t i = 0; i < length; ++i)
+		signal[i] = static_cast<Real>(0.3 * std::sin(0.37 * i) + 0.2 * std::cos(1.91 * i));
+	for (size_t position : positions)
+		for (size_t k = 0; k < pattern.size(); ++k)
+			signal[position + k] += pattern[k];
+	return signal;
+}
+
+inline bool TestCorrelatorMethod(size_t pattern_length, CorrelatorMethod method)
+{
+	const std::vector<Real> pattern = TestCorrelatorPattern(pattern_length);
+	Correlator<Real> filter(1, pattern, Real(0.8 * pattern_length), 0, method);
+	const int delay = static_cast<int>(std::round(filter.GroupDelay()));
+	//The score of the last pattern is calculated less than the minimum distance before the end, so it is only reported by the final call to TakePeaks
+	const std::vector<size_t> positions({ 100, 700, 1500, 4095 - delay - pattern_length / 2 });
+	const std::vector<Real> test_input = TestCorrelatorSignal(pattern, positions, 4096);
+	VectorInput<Real> input(1, test_input);
+	VectorOutput<Real> output(1);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&filter), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		output.Update();
+	}
+	if (filter.Method() != method)
+		return false;
+	//The scores have to match the direct calculation, delayed by the group delay
+	for (int n = delay; n < (int)test_input.size(); ++n) {
+		const int start = n - delay;
+		if (start + pattern_length > test_input.size())
+			break;
+		Real expected = 0;
+		for (size_t k = 0; k < pattern_length; ++k)
+			expected += pattern[k] * test_input[start + k];
+		if (std::abs(output.GetStored()[n] - expected) > 1e-3 * pattern_length)
+			return false;
+	}
+	std::vector<CorrelationPeak> peaks = filter.TakePeaks();
+	if (peaks.size() != positions.size() - 1)
+		return false;
+	const std::vector<CorrelationPeak> last = filter.TakePeaks(true);
+	peaks.insert(peaks.end(), last.cbegin(), last.cend());
+	if (peaks.size() != positions.size())
+		return false;
+	for (size_t i = 0; i < peaks.size(); ++i)
+		if (peaks[i].index != (int64_t)positions[i])
+			return false;
+	return filter.TakePeaks(true).empty();
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref Correlator<Real> with \ref CORRELATOR_DIRECT
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestCorrelatorDirect()
+{
+	return TestCorrelatorMethod(39, CORRELATOR_DIRECT);
+}
+
+
+/**
+ * \brief Test \ref Correlator<Real> with \ref CORRELATOR_FFT
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestCorrelatorFft()
+{
+	return TestCorrelatorMethod(150, CORRELATOR_FFT);
+}
+
+
+#endif //TEST_TEST_CORRELATOR_H_
@@ -0,0 +1,95 @@
+#ifndef TEST_TEST_DECIMATOR_H_
+#define TEST_TEST_DECIMATOR_H_
+
+#include <types.h>
+#include <filter/decimator.h>
+#include <filter/vector_input.h>
+#include <filter/vector_output.h>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \file test/test_decimator.h
+ * \brief This file contains tests for the \ref Decimator.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<typename T>
+inline std::vector<T> Decimate(const std::vector<T>& test_input, double sample_rate, uint32_t factor, Real cutoff_frequency)
+{
+	VectorInput<T> input(sample_rate, test_input);
+	Decimator<T> filter(sample_rate, factor, cutoff_frequency, 63);
+	VectorOutput<T> output(sample_rate / factor);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&filter), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		if (filter.OutputReady())
+			output.Update();
+	}
+	return output.GetStored();
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref Decimator<Real>
+ *
+ * A sine wave below the cutoff frequency has to pass unchanged, one above the new nyquist frequency has to be removed.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestDecimatorReal()
+{
+	const double sample_rate = 48000;
+	const uint32_t factor = 6;
+	std::vector<Real> passband(192 * RealSimd::static_size);
+	std::vector<Real> stopband(192 * RealSimd::static_size);
+	for (int i = 0; i < (int)passband.size(); ++i) {
+		passband[i] = static_cast<Real>(std::sin(boost::math::constants::two_pi<double>() * 500 * i / sample_rate));
+		stopband[i] = static_cast<Real>(std::sin(boost::math::constants::two_pi<double>() * 10000 * i / sample_rate));
+	}
+	const std::vector<Real> passband_output = Decimate(passband, sample_rate, factor, 2500);
+	const std::vector<Real> stopband_output = Decimate(stopband, sample_rate, factor, 2500);
+	if (passband_output.size() != passband.size() / factor)
+		return false;
+	//Skip the samples influenced by the initial zeros of the filter
+	for (int i = 16; i < (int)passband_output.size(); ++i) {
+		const Real expected = static_cast<Real>(std::sin(boost::math::constants::two_pi<double>() * 500 * (i * factor - 31.0) / sample_rate));
+		if (std::abs(passband_output[i] - expected) > 1e-2 || std::abs(stopband_output[i]) > 1e-2)
+			return false;
+	}
+	return true;
+}
+
+
+/**
+ * \brief Test \ref Decimator<Complex>
+ *
+ * A complex exponential below the cutoff frequency has to pass unchanged.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestDecimatorComplex()
+{
+	const double sample_rate = 1000;
+	const uint32_t factor = 3;
+	std::vector<Complex> test_input(96 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = std::polar(Real(1), static_cast<Real>(-boost::math::constants::two_pi<double>() * 20 * i / sample_rate));
+	const std::vector<Complex> output = Decimate(test_input, sample_rate, factor, 100);
+	//Skip the samples influenced by the initial zeros of the filter
+	for (int i = 24; i < (int)output.size(); ++i) {
+		const Complex expected = std::polar(Real(1), static_cast<Real>(-boost::math::constants::two_pi<double>() * 20 * (i * factor - 31.0) / sample_rate));
+		if (std::abs(output[i] - expected) > 1e-2)
+			return false;
+	}
+	return true;
+}
+
+
+#endif //TEST_TEST_DECIMATOR_H_
@@ -0,0 +1,68 @@
+#ifndef TEST_TEST_ENVELOPE_DETECTOR_H_
+#define TEST_TEST_ENVELOPE_DETECTOR_H_
+
+#include <types.h>
+#include <filter/envelope_detector.h>
+#include <filter/vector_input.h>
+#include <filter/vector_output.h>
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \file test/test_envelope_detector.h
+ * \brief This file contains tests for the \ref EnvelopeDetector.
+ */
+
+
+/**
+ * \brief Test \ref EnvelopeDetector<Real>
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestEnvelopeDetectorReal()
+{
+	std::vector<Real> test_input({ -1, 2, -3, 4, 0, -0.5, 0.5, -6, 1, 1, -1, -1, 2, -2, 3, -3 });
+	std::vector<Real> expected_output({ 1, 2, 3, 4, 0, 0.5, 0.5, 6, 1, 1, 1, 1, 2, 2, 3, 3 });
+	VectorInput<Real> input(1, test_input);
+	EnvelopeDetector<Real> filter(1);
+	VectorOutput<Real> output(1);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&filter), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		output.Update();
+	}
+	return output.GetStored() == expected_output;
+}
+
+
+/**
+ * \brief Test \ref EnvelopeDetector<Complex>
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestEnvelopeDetectorComplex()
+{
+	std::vector<Complex> test_input({ Complex(3, 4), Complex(-3, 4), Complex(0, -2), Complex(1, 0),
+		Complex(-5, 12), Complex(0, 0), Complex(8, -6), Complex(-1, 0),
+		Complex(3, 4), Complex(-3, 4), Complex(0, -2), Complex(1, 0),
+		Complex(-5, 12), Complex(0, 0), Complex(8, -6), Complex(-1, 0) });
+	std::vector<Real> expected_output({ 5, 5, 2, 1, 13, 0, 10, 1, 5, 5, 2, 1, 13, 0, 10, 1 });
+	VectorInput<Complex> input(1, test_input);
+	EnvelopeDetector<Complex> filter(1);
+	VectorOutput<Real> output(1);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&filter), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		output.Update();
+	}
+	for (int i = 0; i < (int)expected_output.size(); ++i)
+		if (std::abs(output.GetStored()[i] - expected_output[i]) > 1e-5)
+			return false;
+	return true;
+}
+
+
+#endif //TEST_TEST_ENVELOPE_DETECTOR_H_
\ No newline at end of file
@@ -0,0 +1,118 @@
+#ifndef TEST_TEST_EXTERNAL_BUFFER_IO_H_
+#define TEST_TEST_EXTERNAL_BUFFER_IO_H_
+
+#include <types.h>
+#include <filter/external_buffer_input.h>
+#include <filter/external_buffer_output.h>
+#include <filter/vector_input.h>
+#include <complex>
+#include <vector>
+
+
+/**
+ * \file test/test_external_buffer_io.h
+ * \brief This file contains tests for reading and writing the memory of a host application.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Pass a signal, which is given twice in buffers not fitting the blocks, from an ExternalBufferInput to an ExternalBufferOutput
+inline bool TestExternalBufferComplex(ExternalBufferLayout input_layout, ExternalBufferLayout output_layout)
+{
+	const size_t size = 3 * RealSimd::static_size + 3;
+	std::vector<Complex> signal(size);
+	std::vector<Real> signal_real(size), signal_imag(size);
+	for (size_t i = 0; i < size; ++i) {
+		signal[i] = Complex(Real(i), -Real(i) / 2);
+		signal_real[i] = signal[i].real();
+		signal_imag[i] = signal[i].imag();
+	}
+	ExternalBuffer<const Real> in_buffer;
+	if (input_layout == EXTERNAL_BUFFER_INTERLEAVED)
+		in_buffer.real = reinterpret_cast<const Real*>(signal.data());
+	else {
+		in_buffer.real = signal_real.data();
+		in_buffer.imag = signal_imag.data();
+	}
+	in_buffer.size = size;
+	int refills = 0;
+	ExternalBufferInput<Complex> input(1e3, in_buffer, input_layout, [&](ExternalBuffer<const Real>&) { return ++refills < 2; });
+
+	//The output buffers hold 5 samples, so the host has to collect them
+	std::vector<Complex> collected;
+	std::vector<Complex> out_interleaved(5);
+	std::vector<Real> out_real(5), out_imag(5);
+	ExternalBuffer<Real> out_buffer;
+	if (output_layout == EXTERNAL_BUFFER_INTERLEAVED)
+		out_buffer.real = reinterpret_cast<Real*>(out_interleaved.data());
+	else {
+		out_buffer.real = out_real.data();
+		out_buffer.imag = out_imag.data();
+	}
+	ExternalBufferOutput<Complex> output(1e3, ExternalBuffer<Real>(), output_layout, [&](ExternalBuffer<Real>& buffer) {
+		for (size_t i = 0; i < buffer.size; ++i)
+			collected.push_back(output_layout == EXTERNAL_BUFFER_INTERLEAVED ? out_interleaved[i] : Complex(out_real[i], out_imag[i]));
+		buffer = out_buffer;
+		buffer.size = 5;
+		return true;
+	});
+	output.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+
+	const size_t block_count = 2 * size / RealSimd::static_size + 2;
+	for (size_t block = 0; block < block_count; ++block) {
+		input.Update();
+		output.Update();
+	}
+	bool success = output.Written() == block_count * RealSimd::static_size % 5;
+	output.Flush();
+	success = success && input.EndOfData() && collected.size() == block_count * RealSimd::static_size;
+	for (size_t i = 0; success && i < collected.size(); ++i)
+		success = collected[i] == (i < 2 * size ? signal[i % size] : Complex(0));
+	return success;
+}
+
+//Write a ramp to a buffer of 6 samples, whose callback ends the data, and check that the buffer isn't written again
+inline bool TestExternalBufferEnd()
+{
+	std::vector<Real> ramp(4 * RealSimd::static_size);
+	for (size_t i = 0; i < ramp.size(); ++i)
+		ramp[i] = Real(i + 1);
+	VectorInput<Real> input(1e3, ramp);
+	std::vector<Real> out(6);
+	ExternalBuffer<Real> out_buffer;
+	out_buffer.real = out.data();
+	out_buffer.size = out.size();
+	int flushes = 0;
+	ExternalBufferOutput<Real> output(1e3, out_buffer, EXTERNAL_BUFFER_SPLIT, [&](ExternalBuffer<Real>&) { ++flushes; return false; });
+	output.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	for (size_t block = 0; block < 4; ++block) {
+		input.Update();
+		output.Update();
+	}
+	output.Flush();
+	return flushes == 1 && output.Written() == 0 && out == std::vector<Real>(ramp.cbegin(), ramp.cbegin() + 6);
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref ExternalBufferInput<Complex> and \ref ExternalBufferOutput<Complex>
+ *
+ * A signal, which doesn't fill whole blocks, is read twice from a caller owned buffer and written to
+ * caller owned buffers of 5 samples in every combination of the \ref ExternalBufferLayout. The host has to
+ * get the signal twice followed by zeros, and the input has to report the end of the data. Once the callback of an
+ * \ref ExternalBufferOutput ends the data, the buffer it was given must not be written anymore.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestExternalBufferIO()
+{
+	return TestExternalBufferComplex(EXTERNAL_BUFFER_SPLIT, EXTERNAL_BUFFER_SPLIT)
+		&& TestExternalBufferComplex(EXTERNAL_BUFFER_SPLIT, EXTERNAL_BUFFER_INTERLEAVED)
+		&& TestExternalBufferComplex(EXTERNAL_BUFFER_INTERLEAVED, EXTERNAL_BUFFER_SPLIT)
+		&& TestExternalBufferComplex(EXTERNAL_BUFFER_INTERLEAVED, EXTERNAL_BUFFER_INTERLEAVED)
+		&& TestExternalBufferEnd();
+}
+
+
+#endif //TEST_TEST_EXTERNAL_BUFFER_IO_H_
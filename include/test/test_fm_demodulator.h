@@ -0,0 +1,84 @@
+#ifndef TEST_TEST_FM_DEMODULATOR_H_
+#define TEST_TEST_FM_DEMODULATOR_H_
+
+#include <types.h>
+#include <filter/fast_math.h>
+#include <filter/fm_demodulator.h>
+#include <filter/frequency_modulator.h>
+#include <filter/vector_input.h>
+#include <filter/vector_output.h>
+#include <cmath>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <vector>
+
+
+/**
+ * \file test/test_fm_demodulator.h
+ * \brief This file contains tests for the \ref FmDemodulator.
+ */
+
+
+/**
+ * \brief Test \ref FmDemodulator<Complex>
+ *
+ * Demodulating the output of a \ref FrequencyModulator has to reproduce its input delayed by one sample.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestFmDemodulator()
+{
+	const double sample_rate = 48000;
+	const Real frequency = 3000;
+	const Real bandwidth = 10000;
+	std::vector<Real> test_input(256 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = static_cast<Real>(std::sin(0.01 * i) * 0.9);
+	VectorInput<Real> input(sample_rate, test_input);
+	FrequencyModulator<Complex> modulator(sample_rate, frequency, bandwidth);
+	FmDemodulator<Complex> demodulator(sample_rate, frequency, bandwidth);
+	VectorOutput<Real> output(sample_rate);
+	modulator.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	demodulator.SetInput(0, { static_cast<const Filter*>(&modulator), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&demodulator), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		modulator.Update();
+		demodulator.Update();
+		output.Update();
+	}
+	for (int i = 1; i < (int)test_input.size(); ++i)
+		if (std::abs(output.GetStored()[i] - test_input[i - 1]) > 1e-3)
+			return false;
+	return true;
+}
+
+
+/**
+ * \brief Test \ref FastAtan2
+ *
+ * The angles of vectors all around the unit circle and of different lengths have to be within the documented error.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestFastAtan2()
+{
+	alignas(RealSimd::alignment) Real x[RealSimd::static_size];
+	alignas(RealSimd::alignment) Real y[RealSimd::static_size];
+	alignas(RealSimd::alignment) Real angle[RealSimd::static_size];
+	for (int i = 0; i < 4096; ++i) {
+		for (int k = 0; k < RealSimd::static_size; ++k) {
+			const double phi = 2 * 3.14159265358979323846 * (i * RealSimd::static_size + k) / (4096 * RealSimd::static_size) - 3.14159265358979323846;
+			x[k] = static_cast<Real>((k + 1) * std::cos(phi));
+			y[k] = static_cast<Real>((k + 1) * std::sin(phi));
+		}
+		boost::simd::aligned_store(FastAtan2(boost::simd::aligned_load<RealSimd>(y), boost::simd::aligned_load<RealSimd>(x)), angle);
+		for (int k = 0; k < RealSimd::static_size; ++k)
+			if (std::abs(angle[k] - std::atan2(y[k], x[k])) > 1.2e-5)
+				return false;
+	}
+	return true;
+}
+
+
+#endif //TEST_TEST_FM_DEMODULATOR_H_
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define TEST_TEST_FREQUENCY_GENERATOR_H_
 
 #include <vector>
+#include <cmath>
 #include <boost/math/constants/constants.hpp>
 #include <types.h>
 #include <filter/frequency_generator.h>
@@ -53,4 +54,43 @@ inline bool TestFrequencyGeneratorComplex()
 }
 
 
+
+/**
+ * \brief Test the \ref NCO_TABLE and \ref NCO_ROTATOR modes of \ref FrequencyGenerator<Complex>
+ *
+ * Both modes have to stay close to the exact waveform over many periods.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestFrequencyGeneratorNcoModes()
+{
+	const double sample_rate = 48000;
+	const Real frequency = 1234.5;
+	FrequencyGenerator<Complex> exact(sample_rate, frequency, 1, 1, NCO_SINCOSPI);
+	FrequencyGenerator<Complex> table(sample_rate, frequency, 1, 1, NCO_TABLE);
+	FrequencyGenerator<Complex> rotator(sample_rate, frequency, 1, 1, NCO_ROTATOR);
+	VectorOutput<Complex> exact_output(sample_rate);
+	VectorOutput<Complex> table_output(sample_rate);
+	VectorOutput<Complex> rotator_output(sample_rate);
+	exact_output.SetInput(0, { static_cast<const Filter*>(&exact), 0 });
+	table_output.SetInput(0, { static_cast<const Filter*>(&table), 0 });
+	rotator_output.SetInput(0, { static_cast<const Filter*>(&rotator), 0 });
+	for (int i = 0; i < 10000; ++i) {
+		exact.Update();
+		table.Update();
+		rotator.Update();
+		exact_output.Update();
+		table_output.Update();
+		rotator_output.Update();
+	}
+	for (int i = 0; i < (int)exact_output.GetStored().size(); ++i) {
+		if (std::abs(table_output.GetStored()[i] - exact_output.GetStored()[i]) > 1e-5)
+			return false;
+		if (std::abs(rotator_output.GetStored()[i] - exact_output.GetStored()[i]) > 1e-5)
+			return false;
+	}
+	return true;
+}
+
+
 #endif //TEST_TEST_FREQUENCY_GENERATOR_H_
\ No newline at end of file
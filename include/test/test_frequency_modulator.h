@@ -6,6 +6,8 @@
 #include <filter/vector_input.h>
 #include <filter/vector_output.h>
 #include <vector>
+#include <cmath>
+#include <boost/math/constants/constants.hpp>
 #include <utils.h>
 
 
@@ -48,4 +50,37 @@ inline bool TestFrequencyModulatorComplex()
 }
 
 
+inline bool TestFrequencyModulatorCarrier()
+{
+	const double sample_rate = 48000;
+	const Real frequency = 1000;
+	const Real bandwidth = 2000;
+	std::vector<Real> test_input(4096 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = static_cast<Real>(std::sin(0.001 * i));
+	std::vector<Complex> expected_output(test_input.size());
+	double phase = 0;
+	for (int i = 0; i < (int)test_input.size(); ++i) {
+		expected_output[i] = Complex(static_cast<Real>(std::cos(2 * boost::math::constants::pi<double>() * phase)),
+			static_cast<Real>(std::sin(2 * boost::math::constants::pi<double>() * phase)));
+		phase += (frequency + test_input[i] * bandwidth / 2) / sample_rate;
+		phase -= std::floor(phase);
+	}
+	VectorInput<Real> input(sample_rate, test_input);
+	FrequencyModulator<Complex> modulator(sample_rate, frequency, bandwidth);
+	VectorOutput<Complex> output(sample_rate);
+	modulator.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&modulator), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		modulator.Update();
+		output.Update();
+	}
+	for (int i = 0; i < (int)expected_output.size(); ++i)
+		if (std::abs(output.GetStored()[i] - expected_output[i]) > 1e-3)
+			return false;
+	return true;
+}
+
+
 #endif //TEST_TEST_FREQUENCY_MODULATOR_H_
\ No newline at end of file
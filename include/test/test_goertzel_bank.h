@@ -0,0 +1,83 @@
+#ifndef TEST_TEST_GOERTZEL_BANK_H_
+#define TEST_TEST_GOERTZEL_BANK_H_
+
+#include <types.h>
+#include <filter/goertzel_bank.h>
+#include <filter/vector_input.h>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \file test/test_goertzel_bank.h
+ * \brief This file contains tests for the \ref GoertzelBank filter.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Check that every measurement matches the expected powers
+template<typename T>
+inline bool TestGoertzelBankSignal(const std::vector<T>& test_input, double sample_rate, const std::vector<Real>& frequencies, const std::vector<Real>& expected)
+{
+	const uint32_t block_length = 64;
+	VectorInput<T> input(sample_rate, test_input);
+	GoertzelBank<T> filter(sample_rate, frequencies, block_length);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	int measurements = 0;
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		if (!filter.PowersReady())
+			continue;
+		++measurements;
+		for (size_t k = 0; k < frequencies.size(); ++k)
+			if (std::abs(filter.Powers()[k] - expected[k]) > 1e-3)
+				return false;
+	}
+	return measurements == (int)(test_input.size() / block_length);
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref GoertzelBank<Real>
+ *
+ * Two cosines with amplitudes 2 and 1 have to show up with powers of 1 and 0.25 at their frequencies
+ * and nowhere else. There are more frequencies than fit into one SIMD register.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestGoertzelBankReal()
+{
+	const double sample_rate = 6400;
+	std::vector<Real> test_input(64 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = static_cast<Real>(2 * std::cos(boost::math::constants::two_pi<double>() * 1000 * i / sample_rate)
+		                                  + std::cos(boost::math::constants::two_pi<double>() * 2500 * i / sample_rate));
+	const std::vector<Real> frequencies = { 300, 1000, 1700, 2500, 3000, 1100, 2400, 100, 200 };
+	const std::vector<Real> expected = { 0, 1, 0, 0.25, 0, 0, 0, 0, 0 };
+	return TestGoertzelBankSignal(test_input, sample_rate, frequencies, expected);
+}
+
+
+/**
+ * \brief Test \ref GoertzelBank<Complex>
+ *
+ * A complex exponential with negative frequency has to show up only at its own frequency and not at its mirror image.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestGoertzelBankComplex()
+{
+	const double sample_rate = 6400;
+	std::vector<Complex> test_input(64 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = std::polar(Real(1), static_cast<Real>(-boost::math::constants::two_pi<double>() * 500 * i / sample_rate));
+	const std::vector<Real> frequencies = { -500, 500, 5900 };
+	const std::vector<Real> expected = { 1, 0, 1 };
+	return TestGoertzelBankSignal(test_input, sample_rate, frequencies, expected);
+}
+
+
+#endif //TEST_TEST_GOERTZEL_BANK_H_
@@ -0,0 +1,77 @@
+#ifndef TEST_TEST_LOW_PASS_H_
+#define TEST_TEST_LOW_PASS_H_
+
+#include <types.h>
+#include <filter/low_pass.h>
+#include <filter/vector_input.h>
+#include <filter/vector_output.h>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \file test/test_low_pass.h
+ * \brief This file contains tests for the \ref LowPass filter.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<typename FilterType>
+inline std::vector<Real> ImpulseResponse(FilterType& filter, int length)
+{
+	std::vector<Real> impulse(length, Real(0));
+	impulse[0] = 1;
+	VectorInput<Real> input(1, impulse);
+	VectorOutput<Real> output(1);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	output.SetInput(0, { static_cast<const Filter*>(&filter), 0 });
+	for (int i = 0; i < length / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		output.Update();
+	}
+	return output.GetStored();
+}
+
+inline Real MagnitudeResponse(const std::vector<Real>& impulse_response, Real frequency_norm)
+{
+	Complex sum(0);
+	for (int i = 0; i < (int)impulse_response.size(); ++i)
+		sum += impulse_response[i] * std::polar(Real(1), -boost::math::constants::two_pi<Real>() * frequency_norm * i);
+	return std::abs(sum);
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref LowPass<Real> with \ref MINIMUM_PHASE
+ *
+ * The minimum phase filter has to have the same magnitude response as the linear phase one,
+ * but a considerably smaller group delay.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestLowPassMinimumPhase()
+{
+	constexpr int tapcount = 31;
+	LowPass<Real> linear(1, Real(0.1), tapcount, Hamming, LINEAR_PHASE);
+	LowPass<Real> minimum(1, Real(0.1), tapcount, Hamming, MINIMUM_PHASE);
+	if (std::abs(linear.GroupDelay() - (tapcount - 1) / 2.0) > 1e-6)
+		return false;
+	if (minimum.GroupDelay() <= 0 || minimum.GroupDelay() > (tapcount - 1) / 4.0)
+		return false;
+	if (FirGroupDelay(std::vector<Real>()) != 0)
+		return false;
+	std::vector<Real> linear_response = ImpulseResponse(linear, 32);
+	std::vector<Real> minimum_response = ImpulseResponse(minimum, 32);
+	for (int i = 0; i <= 50; ++i) {
+		const Real frequency_norm = Real(i) / 100;
+		if (std::abs(MagnitudeResponse(linear_response, frequency_norm) - MagnitudeResponse(minimum_response, frequency_norm)) > 1e-3)
+			return false;
+	}
+	return true;
+}
+
+
+#endif //TEST_TEST_LOW_PASS_H_
\ No newline at end of file
@@ -0,0 +1,145 @@
+#ifndef TEST_TEST_PIPE_IO_H_
+#define TEST_TEST_PIPE_IO_H_
+
+#include <types.h>
+#include <io/descriptor.h>
+#include <filter/riff_wave_input.h>
+#include <filter/riff_wave_output.h>
+#include <filter/raw_iq_input.h>
+#include <filter/raw_iq_output.h>
+#include <filter/vector_input.h>
+#include <cmath>
+#include <complex>
+#include <thread>
+#include <vector>
+
+
+/**
+ * \file test/test_pipe_io.h
+ * \brief This file contains tests for streaming WAVE and raw IQ data through pipes.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+//More than the buffer of a pipe and of an InputFile, so both ends have to wait for each other
+inline size_t PipeTestBlockCount()
+{
+	return 3 * InputFile::BufferSize / (4 * RealSimd::static_size) + 5;
+}
+
+inline std::vector<Complex> PipeTestSignal(size_t block_count)
+{
+	std::vector<Complex> signal(block_count * RealSimd::static_size);
+	for (size_t i = 0; i < signal.size(); ++i)
+		signal[i] = std::polar(Real(0.9), Real(0.01) * (i % 4096));
+	return signal;
+}
+
+//Check a block of the read signal against the written one, which is followed by zeros
+inline bool CheckPipeBlock(const std::vector<Complex>& signal, size_t block, std::pair<const Real*, const Real*> out)
+{
+	const Real tolerance = Real(1) / 32767 + Real(1e-6);
+	for (size_t i = 0; i < RealSimd::static_size; ++i) {
+		const size_t n = block * RealSimd::static_size + i;
+		const Complex expected = n < signal.size() ? signal[n] : Complex(0);
+		if (std::abs(out.first[i] - expected.real()) > tolerance || std::abs(out.second[i] - expected.imag()) > tolerance)
+			return false;
+	}
+	return true;
+}
+
+//Stream a signal through a pipe from a RiffWaveOutput to a RiffWaveInput running on another thread
+inline bool TestRiffWavePipe(FileReadMode read_mode, FileWriteMode write_mode)
+{
+	int descriptors[2];
+	if (!OpenPipe(descriptors))
+		return false;
+	const size_t block_count = PipeTestBlockCount();
+	const std::vector<Complex> signal = PipeTestSignal(block_count);
+	std::thread writer([&]() {
+		{
+			VectorInput<Complex> input(48000, signal);
+			RiffWaveOutput<Complex> output(48000, descriptors[1], Real(1), write_mode);
+			output.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+			for (size_t i = 0; i < block_count; ++i) {
+				input.Update();
+				output.Update();
+			}
+		}
+		CloseDescriptor(descriptors[1]);
+	});
+	bool success = true;
+	{
+		RiffWaveInput<Complex> input(descriptors[0], read_mode);
+		success = input.FrameRate() == 48000 && input.ChannelCount() == 2;
+		for (size_t block = 0; block < block_count + 1; ++block) {
+			input.Update();
+			success = CheckPipeBlock(signal, block, input.GetComplex(0)) && success;
+		}
+		success = success && input.eof() && input.FrameCount() == signal.size();
+	}
+	writer.join();
+	CloseDescriptor(descriptors[0]);
+	return success;
+}
+
+//Stream a signal through a pipe from a RawIqOutput to a RawIqInput running on another thread
+inline bool TestRawIqPipe(FileReadMode read_mode, FileWriteMode write_mode)
+{
+	int descriptors[2];
+	if (!OpenPipe(descriptors))
+		return false;
+	const size_t block_count = PipeTestBlockCount();
+	const std::vector<Complex> signal = PipeTestSignal(block_count);
+	std::thread writer([&]() {
+		{
+			VectorInput<Complex> input(1e6, signal);
+			RawIqOutput<Complex> output(1e6, descriptors[1], RAW_IQ_CS16, Real(1), write_mode);
+			output.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+			for (size_t i = 0; i < block_count; ++i) {
+				input.Update();
+				output.Update();
+			}
+			output.Close();
+		}
+		CloseDescriptor(descriptors[1]);
+	});
+	bool success = true;
+	{
+		RawIqInput<Complex> input(1e6, descriptors[0], RAW_IQ_CS16, read_mode);
+		for (size_t block = 0; block < block_count; ++block) {
+			input.Update();
+			success = CheckPipeBlock(signal, block, input.GetComplex(0)) && success;
+		}
+		success = success && !input.EndOfFile();
+		input.Update();
+		success = CheckPipeBlock(signal, block_count, input.GetComplex(0)) && success && input.EndOfFile();
+	}
+	writer.join();
+	CloseDescriptor(descriptors[0]);
+	return success;
+}
+///\endcond
+
+
+/**
+ * \brief Test streaming through pipes
+ *
+ * A complex exponential longer than the buffers of the pipe is written to one end of a pipe by a \ref RiffWaveOutput<Complex>
+ * and a \ref RawIqOutput<Complex> on another thread. It has to be read back from the other end by a \ref RiffWaveInput<Complex>
+ * and a \ref RawIqInput<Complex>, followed by zeros once the writing end is closed. The readers have to notice the end of
+ * the stream, and the \ref RiffWaveInput<Complex> has to know the number of frames then.
+ * All \ref FileReadMode and \ref FileWriteMode combinations that make sense for pipes are tested.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestPipeIO()
+{
+	return TestRiffWavePipe(FILE_READ_STREAM, FILE_WRITE_BUFFERED)
+		&& TestRiffWavePipe(FILE_READ_ASYNC, FILE_WRITE_ASYNC)
+		&& TestRawIqPipe(FILE_READ_STREAM, FILE_WRITE_BUFFERED)
+		&& TestRawIqPipe(FILE_READ_ASYNC, FILE_WRITE_ASYNC);
+}
+
+
+#endif //TEST_TEST_PIPE_IO_H_
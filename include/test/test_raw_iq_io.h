@@ -0,0 +1,102 @@
+#ifndef TEST_TEST_RAW_IQ_IO_H_
+#define TEST_TEST_RAW_IQ_IO_H_
+
+#include <types.h>
+#include <filter/raw_iq_input.h>
+#include <filter/raw_iq_output.h>
+#include <filter/vector_input.h>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+/**
+ * \file test/test_raw_iq_io.h
+ * \brief This file contains tests for reading and writing raw IQ files.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Write a signal with a RawIqOutput and check that a RawIqInput reads it back within the resolution of the format, followed by zeros
+inline bool TestRawIqFile(RawIqFormat format, FileReadMode read_mode, FileWriteMode write_mode, size_t block_count = 37)
+{
+	const std::string path = "test_raw_iq.iq";
+	std::vector<Complex> test_input(block_count * RealSimd::static_size);
+	for (size_t i = 0; i < test_input.size(); ++i)
+		test_input[i] = std::polar(Real(0.9), Real(0.3) * i);
+	{
+		VectorInput<Complex> input(1e6, test_input);
+		RawIqOutput<Complex> output(1e6, path, format, Real(1), write_mode);
+		output.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+		for (size_t i = 0; i < block_count; ++i) {
+			input.Update();
+			output.Update();
+		}
+	}
+	bool success = true;
+	{
+		RawIqInput<Complex> input(1e6, path, format, read_mode);
+		success = input.SampleCount() == test_input.size();
+		const Real tolerance = Real(0.5) / RawIqFullScale(format) + Real(1e-6);
+		for (size_t block = 0; success && block < block_count + 1; ++block) {
+			input.Update();
+			for (size_t i = 0; i < RealSimd::static_size; ++i) {
+				const size_t n = block * RealSimd::static_size + i;
+				const Complex expected = n < test_input.size() ? test_input[n] : Complex(0);
+				if (std::abs(input.GetComplex(0).first[i] - expected.real()) > tolerance || std::abs(input.GetComplex(0).second[i] - expected.imag()) > tolerance)
+					success = false;
+			}
+		}
+		success = success && input.EndOfFile();
+	}
+	std::remove(path.c_str());
+	return success;
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref RawIqInput<Complex> and \ref RawIqOutput<Complex>
+ *
+ * A complex exponential has to be read back within half a step of every format, in every \ref FileReadMode and \ref FileWriteMode.
+ * The file written in \ref FILE_WRITE_ASYNC mode and read in \ref FILE_READ_ASYNC mode is larger than one buffer.
+ * A \ref RAW_IQ_CU8 file of samples alternating between 127 and 128 has to be read without DC offset.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestRawIqIO()
+{
+	const std::string path = "test_raw_iq_cu8.iq";
+	{
+		std::ofstream file(path, std::ios::out | std::ios::binary);
+		for (size_t i = 0; i < 4 * RealSimd::static_size; ++i)
+			file.put(static_cast<char>(127 + i % 2)).put(static_cast<char>(128 - i % 2));
+	}
+	bool success = true;
+	{
+		RawIqInput<Complex> input(1e6, path, RAW_IQ_CU8);
+		for (int block = 0; block < 4; ++block) {
+			input.Update();
+			Real sum = 0;
+			for (size_t i = 0; i < RealSimd::static_size; ++i)
+				sum += input.GetComplex(0).first[i] + input.GetComplex(0).second[i];
+			if (std::abs(sum) > 1e-6 || std::abs(std::abs(input.GetComplex(0).first[0]) - Real(0.5 / 127.5)) > 1e-6)
+				success = false;
+		}
+	}
+	std::remove(path.c_str());
+	const size_t long_block_count = OutputFile::BufferSize / (8 * RealSimd::static_size) + 3;
+	return success
+		&& TestRawIqFile(RAW_IQ_CU8, FILE_READ_STREAM, FILE_WRITE_BUFFERED)
+		&& TestRawIqFile(RAW_IQ_CS8, FILE_READ_MAPPED, FILE_WRITE_BUFFERED)
+		&& TestRawIqFile(RAW_IQ_CS16, FILE_READ_STREAM, FILE_WRITE_BUFFERED)
+		&& TestRawIqFile(RAW_IQ_CF32, FILE_READ_MAPPED, FILE_WRITE_BUFFERED)
+		&& TestRawIqFile(RAW_IQ_CF32, FILE_READ_ASYNC, FILE_WRITE_ASYNC, long_block_count)
+		&& TestRawIqFile(RAW_IQ_CU8, FILE_READ_ASYNC, FILE_WRITE_ASYNC);
+}
+
+
+#endif //TEST_TEST_RAW_IQ_IO_H_
@@ -0,0 +1,489 @@
+#ifndef TEST_TEST_RIFF_WAVE_IO_H_
+#define TEST_TEST_RIFF_WAVE_IO_H_
+
+#include <types.h>
+#include <io/riff_wave.h>
+#include <filter/riff_wave_input.h>
+#include <filter/riff_wave_output.h>
+#include <filter/vector_input.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+/**
+ * \file test/test_riff_wave_io.h
+ * \brief This file contains tests for reading and writing WAVE files.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+//The sample of a channel in a frame of the test files
+inline int16_t TestRiffWaveSample(uint32_t frame, int channel, uint16_t bits)
+{
+	const int value = static_cast<int>((frame * 7 + channel * 31) % 201) - 100;
+	return static_cast<int16_t>(bits == 8 ? value : 300 * value);
+}
+
+//Write a test file and check that a RiffWaveInput reads the same samples back, followed by zeros
+template<typename T>
+inline bool TestRiffWaveInputFile(FileReadMode mode, uint16_t channel_count, uint16_t bits, uint32_t frame_count = 5 * RealSimd::static_size + 3, RiffWaveContainer container = RIFF_WAVE_RIFF)
+{
+	const std::string path = "test_riff_wave_input.wav";
+	{
+		RIFFWaveOStream out(path, 8000, channel_count);
+		if (container == RIFF_WAVE_RF64)
+			out.setRf64();
+		else if (container == RIFF_WAVE_W64)
+			out.setWave64();
+		if (bits == 8)
+			out.set8BitsPerSample();
+		else
+			out.set16BitsPerSample();
+		std::vector<int16_t> frame(channel_count);
+		for (uint32_t i = 0; i < frame_count; ++i) {
+			for (int channel = 0; channel < channel_count; ++channel)
+				frame[channel] = TestRiffWaveSample(i, channel, bits);
+			out << frame.data();
+		}
+	}
+	bool success = true;
+	{
+		RiffWaveInput<T> input(path, mode);
+		std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+		success = input.FrameCount() == frame_count && input.ChannelCount() == channel_count && input.BitsPerSample() == bits
+			&& input.Container() == container && input.FileSize() == static_cast<uint64_t>(file.tellg());
+		const Real scale = Real(1) / input.MaxSampleValue();
+		//8 bit samples are offset binary and are read relative to the middle of their range, which lies half a step below the code of a zero
+		const Real offset = bits == 8 ? Real(0.5) : Real(0);
+		const bool complex = std::is_same<T, Complex>::value;
+		for (uint32_t block = 0; success && block < frame_count / RealSimd::static_size + 2; ++block) {
+			input.Update();
+			for (int channel = 0; channel < channel_count; ++channel) {
+				const Real* out = complex
+					? (channel % 2 == 0 ? input.GetComplex(channel / 2).first : input.GetComplex(channel / 2).second)
+					: input.GetReal(channel);
+				for (uint32_t i = 0; i < RealSimd::static_size; ++i) {
+					const uint32_t frame = block * RealSimd::static_size + i;
+					const Real expected = frame < frame_count ? (TestRiffWaveSample(frame, channel, bits) + offset) * scale : Real(0);
+					if (std::abs(out[i] - expected) > 1e-6)
+						success = false;
+				}
+			}
+		}
+	}
+	std::remove(path.c_str());
+	return success;
+}
+
+//Append a little endian number to a byte vector
+template<typename T>
+inline void TestAppendBytes(std::vector<uint8_t>& bytes, T value, size_t size = sizeof(T))
+{
+	uint8_t raw[sizeof(T)];
+	memcpy(raw, &value, sizeof(T));
+	bytes.insert(bytes.end(), raw, raw + size);
+}
+
+//Write a file in one of the formats RIFFWaveOStream can't write by hand and check that RiffWaveInput reads it back or rejects it
+inline bool TestRiffWaveInputFormat(uint16_t format, uint16_t bits, uint16_t channel_count, bool extensible, FileReadMode mode)
+{
+	const std::string path = "test_riff_wave_format.wav";
+	const uint32_t frame_count = 7 * RealSimd::static_size + 1;
+	std::vector<uint8_t> data;
+	std::vector<Real> expected;
+	for (uint32_t i = 0; i < frame_count; ++i) {
+		for (int channel = 0; channel < channel_count; ++channel) {
+			const double x = TestRiffWaveSample(i, channel, 8) / 128.0;
+			if (format == RIFF_WAVE_IEEE_FLOAT && bits == 32) {
+				TestAppendBytes(data, static_cast<float>(x));
+				expected.push_back(static_cast<float>(x));
+			}
+			else if (format == RIFF_WAVE_IEEE_FLOAT) {
+				TestAppendBytes(data, x);
+				expected.push_back(static_cast<Real>(x));
+			}
+			else {
+				const double max = static_cast<double>((uint64_t(1) << (bits - 1)) - 1);
+				const int32_t n = static_cast<int32_t>(std::round(x * max));
+				TestAppendBytes(data, n, bits / 8);
+				expected.push_back(static_cast<Real>(n / max));
+			}
+		}
+	}
+	std::vector<uint8_t> header;
+	const uint16_t frame_size = channel_count * bits / 8;
+	const uint32_t format_length = extensible ? 40 : 16;
+	TestAppendBytes(header, uint32_t(0x46464952));
+	TestAppendBytes(header, static_cast<uint32_t>(4 + 8 + format_length + 8 + data.size()));
+	TestAppendBytes(header, uint32_t(0x45564157));
+	TestAppendBytes(header, uint32_t(0x20746D66));
+	TestAppendBytes(header, format_length);
+	TestAppendBytes(header, extensible ? uint16_t(RIFF_WAVE_EXTENSIBLE) : format);
+	TestAppendBytes(header, channel_count);
+	TestAppendBytes(header, uint32_t(8000));
+	TestAppendBytes(header, uint32_t(8000) * frame_size);
+	TestAppendBytes(header, frame_size);
+	TestAppendBytes(header, bits);
+	if (extensible) {
+		const uint8_t guid_tail[] = { 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+		TestAppendBytes(header, uint16_t(22));
+		TestAppendBytes(header, bits);
+		TestAppendBytes(header, uint32_t(0));
+		TestAppendBytes(header, format);
+		header.insert(header.end(), guid_tail, guid_tail + sizeof(guid_tail));
+	}
+	TestAppendBytes(header, uint32_t(0x61746164));
+	TestAppendBytes(header, static_cast<uint32_t>(data.size()));
+	{
+		std::ofstream file(path, std::ios::out | std::ios::binary);
+		file.write(reinterpret_cast<const char*>(header.data()), header.size());
+		file.write(reinterpret_cast<const char*>(data.data()), data.size());
+	}
+	bool success = true;
+	try {
+		RiffWaveInput<Real> input(path, mode);
+		success = input.FrameCount() == frame_count && input.SampleFormat() == format && input.BitsPerSample() == bits;
+		for (uint32_t block = 0; success && block < frame_count / RealSimd::static_size + 1; ++block) {
+			input.Update();
+			for (int channel = 0; channel < channel_count; ++channel) {
+				for (uint32_t i = 0; i < RealSimd::static_size; ++i) {
+					const uint32_t frame = block * RealSimd::static_size + i;
+					const Real value = frame < frame_count ? expected[frame * channel_count + channel] : Real(0);
+					if (std::abs(input.GetReal(channel)[i] - value) > 1e-6)
+						success = false;
+				}
+			}
+		}
+	}
+	catch (const std::invalid_argument&) {
+		success = false;
+	}
+	std::remove(path.c_str());
+	return success;
+}
+
+//Append a chunk of a RIFF file with arbitrary contents
+inline void TestAppendChunk(std::vector<uint8_t>& bytes, const char* id, uint32_t size)
+{
+	bytes.insert(bytes.end(), id, id + 4);
+	TestAppendBytes(bytes, size);
+	for (uint32_t i = 0; i < size + size % 2; ++i)
+		bytes.push_back(static_cast<uint8_t>(i));
+}
+
+//Write a stereo file with the format and data chunk between other chunks and check that frames can be read from anywhere
+inline bool TestRiffWaveChunkFile(FileReadMode mode, bool unknown_size)
+{
+	const std::string path = "test_riff_wave_chunks.wav";
+	const uint32_t frame_count = 9 * RealSimd::static_size + 5;
+	std::vector<uint8_t> bytes;
+	bytes.insert(bytes.end(), { 'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E' });
+	TestAppendChunk(bytes, "bext", 3);
+	TestAppendChunk(bytes, "LIST", 10);
+	bytes.insert(bytes.end(), { 'f', 'm', 't', ' ' });
+	TestAppendBytes(bytes, uint32_t(16));
+	TestAppendBytes(bytes, uint16_t(RIFF_WAVE_PCM));
+	TestAppendBytes(bytes, uint16_t(2));
+	TestAppendBytes(bytes, uint32_t(8000));
+	TestAppendBytes(bytes, uint32_t(32000));
+	TestAppendBytes(bytes, uint16_t(4));
+	TestAppendBytes(bytes, uint16_t(16));
+	bytes.insert(bytes.end(), { 'f', 'a', 'c', 't' });
+	TestAppendBytes(bytes, uint32_t(4));
+	TestAppendBytes(bytes, frame_count);
+	bytes.insert(bytes.end(), { 'd', 'a', 't', 'a' });
+	TestAppendBytes(bytes, unknown_size ? uint32_t(0xFFFFFFFF) : 4 * frame_count);
+	for (uint32_t i = 0; i < frame_count; ++i)
+		for (int channel = 0; channel < 2; ++channel)
+			TestAppendBytes(bytes, TestRiffWaveSample(i, channel, 16));
+	if (!unknown_size)
+		TestAppendChunk(bytes, "LIST", 7);
+	const uint32_t riff_size = static_cast<uint32_t>(bytes.size() - 8);
+	memcpy(bytes.data() + 4, &riff_size, sizeof(riff_size));
+	{
+		std::ofstream file(path, std::ios::out | std::ios::binary);
+		file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	}
+	bool success = true;
+	{
+		RIFFWaveIStream input(path, mode);
+		std::vector<std::string> ids;
+		for (const RiffWaveChunk& chunk : input.Chunks())
+			ids.push_back(chunk.id);
+		const std::vector<std::string> expected_ids = unknown_size
+			? std::vector<std::string>{ "bext", "LIST", "fmt ", "fact", "data" }
+			: std::vector<std::string>{ "bext", "LIST", "fmt ", "fact", "data", "LIST" };
+		success = input.FrameCount() == frame_count && input.ChannelCount() == 2 && ids == expected_ids;
+		//Jump around in the file, including reads across the end
+		const uint64_t offsets[] = { 17, 3, frame_count - 2, 0, frame_count + 10, 5 * RealSimd::static_size };
+		for (uint64_t offset : offsets) {
+			uint32_t count = 11;
+			const uint8_t* frames = input.readFrames(offset, count);
+			const uint64_t first = std::min<uint64_t>(offset, frame_count);
+			success = success && count == std::min<uint64_t>(11, frame_count - first) && input.tellFrame() == first + count;
+			for (uint32_t i = 0; success && i < count; ++i) {
+				int16_t sample[2];
+				memcpy(sample, frames + 4 * i, sizeof(sample));
+				success = sample[0] == TestRiffWaveSample(static_cast<uint32_t>(first + i), 0, 16) && sample[1] == TestRiffWaveSample(static_cast<uint32_t>(first + i), 1, 16);
+			}
+		}
+	}
+	{
+		//A RiffWaveInput starts putting out the frames at the position it was moved to
+		RiffWaveInput<Complex> input(path, mode);
+		input.seekFrame(2 * RealSimd::static_size + 1);
+		input.Update();
+		for (uint32_t i = 0; i < RealSimd::static_size; ++i) {
+			const uint32_t frame = 2 * RealSimd::static_size + 1 + i;
+			if (std::abs(input.GetComplex(0).first[i] - TestRiffWaveSample(frame, 0, 16) / Real(32767)) > 1e-6
+				|| std::abs(input.GetComplex(0).second[i] - TestRiffWaveSample(frame, 1, 16) / Real(32767)) > 1e-6)
+				success = false;
+		}
+	}
+	std::remove(path.c_str());
+	return success;
+}
+
+//Write a file, which lacks a part of its headers, and check that it is rejected
+inline bool TestRiffWaveMalformedFile(const char* signature, bool has_format, bool has_data)
+{
+	const std::string path = "test_riff_wave_malformed.wav";
+	std::vector<uint8_t> bytes;
+	bytes.insert(bytes.end(), signature, signature + 4);
+	TestAppendBytes(bytes, uint32_t(0));
+	bytes.insert(bytes.end(), { 'W', 'A', 'V', 'E' });
+	if (has_format) {
+		bytes.insert(bytes.end(), { 'f', 'm', 't', ' ' });
+		TestAppendBytes(bytes, uint32_t(16));
+		TestAppendBytes(bytes, uint16_t(RIFF_WAVE_PCM));
+		TestAppendBytes(bytes, uint16_t(1));
+		TestAppendBytes(bytes, uint32_t(8000));
+		TestAppendBytes(bytes, uint32_t(16000));
+		TestAppendBytes(bytes, uint16_t(2));
+		TestAppendBytes(bytes, uint16_t(16));
+	}
+	TestAppendChunk(bytes, "LIST", 6);
+	if (has_data)
+		TestAppendChunk(bytes, "data", 8);
+	const uint32_t riff_size = static_cast<uint32_t>(bytes.size() - 8);
+	memcpy(bytes.data() + 4, &riff_size, sizeof(riff_size));
+	{
+		std::ofstream file(path, std::ios::out | std::ios::binary);
+		file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	}
+	bool rejected = false;
+	try {
+		RIFFWaveIStream input(path, FILE_READ_STREAM);
+	}
+	catch (const std::invalid_argument&) {
+		rejected = true;
+	}
+	std::remove(path.c_str());
+	return rejected;
+}
+
+//Check that opening a file which doesn't exist is rejected
+inline bool TestRiffWaveMissingFile()
+{
+	try {
+		RiffWaveInput<Real> input("test_riff_wave_missing.wav");
+	}
+	catch (const std::runtime_error&) {
+		return true;
+	}
+	return false;
+}
+
+//Write a signal with a RiffWaveOutput and check that it is read back rounded and saturated
+template<typename T>
+inline bool TestRiffWaveOutputFile(const std::vector<T>& test_input, uint16_t bits, FileWriteMode mode = FILE_WRITE_BUFFERED)
+{
+	const std::string path = "test_riff_wave_output.wav";
+	{
+		VectorInput<T> input(8000, test_input);
+		RiffWaveOutput<T> output(8000, path, Real(0.5), mode);
+		if (bits == 8)
+			output.set8BitsPerSample();
+		output.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+		for (size_t i = 0; i < test_input.size() / RealSimd::static_size; ++i) {
+			input.Update();
+			output.Update();
+		}
+	}
+	bool success = true;
+	{
+		RiffWaveInput<T> input(path);
+		success = input.FrameCount() == test_input.size() && input.BitsPerSample() == bits;
+		const Real max = input.MaxSampleValue();
+		//8 bit samples are offset binary around the middle of their range
+		const Real offset = bits == 8 ? Real(127.5) : Real(0);
+		const Real lowest = bits == 8 ? Real(0) : -max - 1;
+		const Real highest = bits == 8 ? Real(255) : max;
+		auto expected = [=](Real x) { return (std::min(std::max(std::round(Real(0.5) * max * x + offset), lowest), highest) - offset) / max; };
+		for (size_t block = 0; success && block < test_input.size() / RealSimd::static_size; ++block) {
+			input.Update();
+			for (size_t i = 0; i < RealSimd::static_size; ++i) {
+				const Complex x = test_input[block * RealSimd::static_size + i];
+				const Real* out_real = std::is_same<T, Complex>::value ? input.GetComplex(0).first : input.GetReal(0);
+				if (std::abs(out_real[i] - expected(x.real())) > 1e-6)
+					success = false;
+				if (std::is_same<T, Complex>::value && std::abs(input.GetComplex(0).second[i] - expected(x.imag())) > 1e-6)
+					success = false;
+			}
+		}
+	}
+	std::remove(path.c_str());
+	return success;
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref RiffWaveInput<Real>
+ *
+ * Files with one and three channels of 8 and 16 bits per sample have to be read back exactly in every \ref FileReadMode.
+ * The file read in \ref FILE_READ_ASYNC mode is larger than one buffer, and its frames don't fit evenly into them.
+ * A file which doesn't exist has to be rejected.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestRiffWaveInputReal()
+{
+	return TestRiffWaveInputFile<Real>(FILE_READ_STREAM, 3, 16)
+		&& TestRiffWaveInputFile<Real>(FILE_READ_STREAM, 3, 8)
+		&& TestRiffWaveInputFile<Real>(FILE_READ_MAPPED, 3, 16)
+		&& TestRiffWaveInputFile<Real>(FILE_READ_MAPPED, 3, 8)
+		&& TestRiffWaveInputFile<Real>(FILE_READ_MAPPED, 1, 16)
+		&& TestRiffWaveInputFile<Real>(FILE_READ_STREAM, 1, 8)
+		&& TestRiffWaveInputFile<Real>(FILE_READ_ASYNC, 3, 16, InputFile::BufferSize / 5)
+		&& TestRiffWaveMissingFile();
+}
+
+
+/**
+ * \brief Test \ref RiffWaveInput<Complex>
+ *
+ * Files with two and four channels have to be read back as one and two complex outputs in every \ref FileReadMode.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestRiffWaveInputComplex()
+{
+	return TestRiffWaveInputFile<Complex>(FILE_READ_STREAM, 4, 16)
+		&& TestRiffWaveInputFile<Complex>(FILE_READ_MAPPED, 4, 16)
+		&& TestRiffWaveInputFile<Complex>(FILE_READ_MAPPED, 2, 8)
+		&& TestRiffWaveInputFile<Complex>(FILE_READ_STREAM, 2, 16)
+		&& TestRiffWaveInputFile<Complex>(FILE_READ_ASYNC, 2, 16);
+}
+
+
+/**
+ * \brief Test reading and writing the containers of WAVE files
+ *
+ * Files written as \ref RIFF_WAVE_RF64 and \ref RIFF_WAVE_W64 files have to be read back exactly, and the
+ * size in their headers has to match the size of the file.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestRiffWaveContainers()
+{
+	return TestRiffWaveInputFile<Real>(FILE_READ_MAPPED, 3, 16, 5 * RealSimd::static_size + 3, RIFF_WAVE_RF64)
+		&& TestRiffWaveInputFile<Real>(FILE_READ_STREAM, 1, 8, 5 * RealSimd::static_size + 3, RIFF_WAVE_RF64)
+		&& TestRiffWaveInputFile<Real>(FILE_READ_MAPPED, 1, 8, 5 * RealSimd::static_size + 3, RIFF_WAVE_W64)
+		&& TestRiffWaveInputFile<Real>(FILE_READ_STREAM, 3, 16, 5 * RealSimd::static_size + 3, RIFF_WAVE_W64)
+		&& TestRiffWaveInputFile<Complex>(FILE_READ_ASYNC, 2, 16, 5 * RealSimd::static_size + 3, RIFF_WAVE_W64);
+}
+
+
+/**
+ * \brief Test walking through the chunks of a WAVE file and seeking to a frame
+ *
+ * The format and data chunk of a file have to be found between bext, LIST and fact chunks, also if the size
+ * of the data chunk is unknown, which means it lasts until the end of the file. Frames read from arbitrary
+ * offsets have to match the ones written, in every \ref FileReadMode. Files with an unknown signature or
+ * without a format or data chunk have to be rejected.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestRiffWaveChunks()
+{
+	return TestRiffWaveChunkFile(FILE_READ_STREAM, false)
+		&& TestRiffWaveChunkFile(FILE_READ_MAPPED, false)
+		&& TestRiffWaveChunkFile(FILE_READ_ASYNC, false)
+		&& TestRiffWaveChunkFile(FILE_READ_MAPPED, true)
+		&& TestRiffWaveMalformedFile("RIFX", true, true)
+		&& TestRiffWaveMalformedFile("RIFF", false, true)
+		&& TestRiffWaveMalformedFile("RIFF", true, false);
+}
+
+
+/**
+ * \brief Test \ref RiffWaveInput<Real> with the sample formats beyond 8 and 16 bit integers
+ *
+ * Files with 32 and 64 bit floating point samples, 24 and 32 bit integer samples and extensible format headers
+ * have to be read back with the precision of their samples. A file with 16 bit floating point samples has to be rejected.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestRiffWaveInputFormats()
+{
+	return TestRiffWaveInputFormat(RIFF_WAVE_IEEE_FLOAT, 32, 1, false, FILE_READ_MAPPED)
+		&& TestRiffWaveInputFormat(RIFF_WAVE_IEEE_FLOAT, 32, 2, false, FILE_READ_STREAM)
+		&& TestRiffWaveInputFormat(RIFF_WAVE_IEEE_FLOAT, 64, 1, false, FILE_READ_STREAM)
+		&& TestRiffWaveInputFormat(RIFF_WAVE_IEEE_FLOAT, 64, 3, false, FILE_READ_MAPPED)
+		&& TestRiffWaveInputFormat(RIFF_WAVE_PCM, 24, 1, false, FILE_READ_MAPPED)
+		&& TestRiffWaveInputFormat(RIFF_WAVE_PCM, 24, 3, false, FILE_READ_STREAM)
+		&& TestRiffWaveInputFormat(RIFF_WAVE_PCM, 32, 2, false, FILE_READ_MAPPED)
+		&& TestRiffWaveInputFormat(RIFF_WAVE_IEEE_FLOAT, 32, 2, true, FILE_READ_MAPPED)
+		&& TestRiffWaveInputFormat(RIFF_WAVE_PCM, 24, 2, true, FILE_READ_ASYNC)
+		&& !TestRiffWaveInputFormat(RIFF_WAVE_IEEE_FLOAT, 16, 1, false, FILE_READ_STREAM);
+}
+
+
+/**
+ * \brief Test \ref RiffWaveOutput<Real>
+ *
+ * A ramp from -3 to 3, written with a dampening factor of 0.5 and 8 and 16 bits per sample, has to be
+ * read back rounded to the nearest integer sample and saturated outside of `[-1, 1]`. The ramp written
+ * in \ref FILE_WRITE_ASYNC mode is larger than one buffer.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestRiffWaveOutputReal()
+{
+	std::vector<Real> test_input(64 * RealSimd::static_size);
+	for (size_t i = 0; i < test_input.size(); ++i)
+		test_input[i] = Real(-3) + Real(6) * i / test_input.size();
+	std::vector<Real> long_input(OutputFile::BufferSize / 2 + 64 * RealSimd::static_size);
+	for (size_t i = 0; i < long_input.size(); ++i)
+		long_input[i] = Real(-3) + Real(6) * i / long_input.size();
+	return TestRiffWaveOutputFile(test_input, 16) && TestRiffWaveOutputFile(test_input, 8)
+		&& TestRiffWaveOutputFile(long_input, 16, FILE_WRITE_ASYNC);
+}
+
+
+/**
+ * \brief Test \ref RiffWaveOutput<Complex>
+ *
+ * A complex exponential with an amplitude of 3 has to be written to two channels, rounded and saturated, in every \ref FileWriteMode.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestRiffWaveOutputComplex()
+{
+	std::vector<Complex> test_input(64 * RealSimd::static_size);
+	for (size_t i = 0; i < test_input.size(); ++i)
+		test_input[i] = std::polar(Real(3), Real(0.1) * i);
+	return TestRiffWaveOutputFile(test_input, 16) && TestRiffWaveOutputFile(test_input, 8)
+		&& TestRiffWaveOutputFile(test_input, 16, FILE_WRITE_ASYNC);
+}
+
+
+#endif //TEST_TEST_RIFF_WAVE_IO_H_
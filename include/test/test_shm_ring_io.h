@@ -0,0 +1,109 @@
+#ifndef TEST_TEST_SHM_RING_IO_H_
+#define TEST_TEST_SHM_RING_IO_H_
+
+#include <types.h>
+#include <filter/shm_ring_input.h>
+#include <filter/shm_ring_output.h>
+#include <filter/vector_input.h>
+#include <complex>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/**
+ * \file test/test_shm_ring_io.h
+ * \brief This file contains tests for passing samples through shared memory.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+inline Real ShmRingTestValue(size_t n, size_t part)
+{
+	return static_cast<Real>(n % 1000) / 1000 - part;
+}
+
+inline void ShmRingTestSample(size_t n, Real& sample)
+{
+	sample = ShmRingTestValue(n, 0);
+}
+
+inline void ShmRingTestSample(size_t n, Complex& sample)
+{
+	sample = Complex(ShmRingTestValue(n, 0), ShmRingTestValue(n, 1));
+}
+
+//Check a block of the output against the test signal of `count` samples, which is followed by zeros
+inline bool CheckShmRingBlock(const ShmRingInput<Real>& input, size_t block, size_t count)
+{
+	for (size_t i = 0; i < RealSimd::static_size; ++i) {
+		const size_t n = block * RealSimd::static_size + i;
+		if (input.GetReal(0)[i] != (n < count ? ShmRingTestValue(n, 0) : 0))
+			return false;
+	}
+	return true;
+}
+
+inline bool CheckShmRingBlock(const ShmRingInput<Complex>& input, size_t block, size_t count)
+{
+	for (size_t i = 0; i < RealSimd::static_size; ++i) {
+		const size_t n = block * RealSimd::static_size + i;
+		if (input.GetComplex(0).first[i] != (n < count ? ShmRingTestValue(n, 0) : 0) || input.GetComplex(0).second[i] != (n < count ? ShmRingTestValue(n, 1) : 0))
+			return false;
+	}
+	return true;
+}
+
+//Pass a signal from a ShmRingOutput on another thread to a ShmRingInput, which stops after `read_block_count` blocks
+template<typename T>
+inline bool TestShmRingStream(size_t block_count, size_t read_block_count)
+{
+	const std::string name = "SignalProcessingTestRing";
+	ShmRing::Remove(name);
+	std::vector<T> signal(block_count * RealSimd::static_size);
+	for (size_t i = 0; i < signal.size(); ++i)
+		ShmRingTestSample(i, signal[i]);
+	std::unique_ptr<ShmRingInput<T>> input(new ShmRingInput<T>(1e6, name, 4));
+	std::thread writer([&]() {
+		VectorInput<T> vector(1e6, signal);
+		ShmRingOutput<T> output(1e6, name, 4);
+		output.SetInput(0, { static_cast<const Filter*>(&vector), 0 });
+		for (size_t i = 0; i < block_count; ++i) {
+			vector.Update();
+			output.Update();
+		}
+	});
+	bool success = true;
+	for (size_t block = 0; block < read_block_count; ++block) {
+		input->Update();
+		success = CheckShmRingBlock(*input, block, signal.size()) && success;
+	}
+	success = success && input->EndOfStream() == (read_block_count > block_count);
+	//The writer must not wait for a reader that is gone
+	input.reset();
+	writer.join();
+	return success;
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref ShmRingInput and \ref ShmRingOutput
+ *
+ * A signal several times longer than the ring, which doesn't fill the last block of the ring, is passed from
+ * a \ref ShmRingOutput on another thread to a \ref ShmRingInput. It has to arrive unchanged and be followed by
+ * zeros and the end of the stream. A \ref ShmRingInput closed early must not block the \ref ShmRingOutput.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestShmRingIO()
+{
+	const size_t block_count = 5 * 4 * ShmRingSampleBlocks + 7;
+	return TestShmRingStream<Real>(block_count, block_count + 3)
+		&& TestShmRingStream<Complex>(block_count, block_count + 3)
+		&& TestShmRingStream<Complex>(block_count, 100);
+}
+
+
+#endif //TEST_TEST_SHM_RING_IO_H_
@@ -0,0 +1,133 @@
+#ifndef TEST_TEST_STFT_H_
+#define TEST_TEST_STFT_H_
+
+#include <types.h>
+#include <filter/fft.h>
+#include <filter/stft.h>
+#include <filter/vector_input.h>
+#include <boost/math/constants/constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \file test/test_stft.h
+ * \brief This file contains tests for the \ref FftPlan and the \ref Stft filter.
+ */
+
+
+/**
+ * \brief Test \ref FftPlan
+ *
+ * The FFT has to match a directly calculated DFT and the inverse FFT has to restore the input.
+ * Plans of the same size have to be shared.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestFft()
+{
+	const size_t size = 64;
+	std::shared_ptr<const FftPlan> plan = FftPlan::Get(size);
+	if (plan != FftPlan::Get(size) || plan->Size() != size)
+		return false;
+	std::vector<Complex> signal(size);
+	for (size_t i = 0; i < size; ++i)
+		signal[i] = Complex(static_cast<Real>(std::sin(0.3 * i * i)), static_cast<Real>(std::cos(1.7 * i)));
+	AlignedStdVec<Real> real(size), imag(size);
+	for (size_t i = 0; i < size; ++i) {
+		real[i] = signal[i].real();
+		imag[i] = signal[i].imag();
+	}
+	plan->Forward(real.data(), imag.data());
+	for (size_t k = 0; k < size; ++k) {
+		Complex expected(0);
+		for (size_t n = 0; n < size; ++n)
+			expected += signal[n] * std::polar(Real(1), static_cast<Real>(-boost::math::constants::two_pi<double>() * k * n / size));
+		if (std::abs(Complex(real[k], imag[k]) - expected) > 1e-3)
+			return false;
+	}
+	plan->Inverse(real.data(), imag.data());
+	for (size_t i = 0; i < size; ++i)
+		if (std::abs(Complex(real[i], imag[i]) / Real(size) - signal[i]) > 1e-5)
+			return false;
+	return true;
+}
+
+
+/**
+ * \brief Test \ref Stft<Real>
+ *
+ * A cosine at the center of a bin has to show up in that bin and its mirror image, once per hop.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestStftReal()
+{
+	const uint32_t size = 128;
+	const uint32_t hop = 32;
+	const uint32_t bin = 10;
+	std::vector<Real> test_input(64 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = static_cast<Real>(std::cos(boost::math::constants::two_pi<double>() * bin * i / size));
+	VectorInput<Real> input(1, test_input);
+	Stft<Real> filter(1, size, hop);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	int frames = 0;
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		if (!filter.FrameReady())
+			continue;
+		++frames;
+		//Skip the frames containing the initial zeros
+		if ((i + 1) * RealSimd::static_size < size)
+			continue;
+		for (uint32_t k = 0; k < size; ++k) {
+			//The Hann window spreads the energy to the neighbouring bins with half the magnitude
+			const uint32_t to_bin = (k + size - bin) % size;
+			const uint32_t to_mirror = (k + bin) % size;
+			const uint32_t distance = std::min(std::min(to_bin, size - to_bin), std::min(to_mirror, size - to_mirror));
+			const Real expected = distance == 0 ? Real(size / 4) : distance == 1 ? Real(size / 8) : Real(0);
+			if (std::abs(std::abs(Complex(filter.FrameReal()[k], filter.FrameImag()[k])) - expected) > 1e-3)
+				return false;
+		}
+	}
+	return frames == (int)test_input.size() / (int)hop;
+}
+
+
+/**
+ * \brief Test \ref Stft<Complex>
+ *
+ * A complex exponential at the center of a bin has to show up only in that bin.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestStftComplex()
+{
+	const uint32_t size = 64;
+	const uint32_t hop = 64;
+	const uint32_t bin = 50;
+	std::vector<Complex> test_input(64 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = std::polar(Real(1), static_cast<Real>(boost::math::constants::two_pi<double>() * bin * i / size));
+	VectorInput<Complex> input(1, test_input);
+	Stft<Complex> filter(1, size, hop, Rectangular);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		if (!filter.FrameReady())
+			continue;
+		for (uint32_t k = 0; k < size; ++k) {
+			const Real expected = k == bin ? Real(size) : Real(0);
+			if (std::abs(std::abs(Complex(filter.FrameReal()[k], filter.FrameImag()[k])) - expected) > 1e-3)
+				return false;
+		}
+	}
+	return true;
+}
+
+
+#endif //TEST_TEST_STFT_H_
@@ -4,6 +4,8 @@
 #include <filter/vector_input.h>
 #include <filter/vector_output.h>
 #include <types.h>
+#include <algorithm>
+#include <vector>
 
 
 /**
@@ -53,4 +55,98 @@ inline bool TestVectorIOComplex()
 }
 
 
+///\cond IMPLEMENTATION_DETAILS
+//Output data shorter than a block and not a multiple of it, so the wrap around happens at every position of a block
+inline bool TestVectorInputRepeat(bool split)
+{
+	const std::vector<Complex> test_input({ Complex(0, -1), Complex(1, -2), Complex(2, -3), Complex(3, -4), Complex(4, -5) });
+	const std::vector<Real> real_input({ 0, 1, 2 });
+	VectorInput<Complex> input(1, test_input, split);
+	VectorInput<Real> real(1, real_input);
+	VectorOutput<Complex> output(1);
+	output.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	bool success = true;
+	for (size_t block = 0; block < 7; ++block) {
+		input.Update();
+		real.Update();
+		output.Update();
+		for (size_t i = 0; i < RealSimd::static_size; ++i)
+			success = success && real.GetReal(0)[i] == real_input[(block * RealSimd::static_size + i) % real_input.size()];
+	}
+	for (size_t i = 0; i < output.GetStored().size(); ++i)
+		success = success && output.GetStored()[i] == test_input[i % test_input.size()];
+	return success;
+}
+///\endcond
+
+
+/**
+ * \brief Tests the wrap around of \ref VectorInput.
+ *
+ * Data shorter than a block, which is not a multiple of its length, has to be repeated seamlessly,
+ * with and without the \ref Complex data stored split.
+ *
+ * \returns A bool indicating if the test succeeded.
+ */
+inline bool TestVectorInputWrap()
+{
+	return TestVectorInputRepeat(false) && TestVectorInputRepeat(true);
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Store a signal spanning several chunks and compare the stored samples with the expected ones, also in the middle of the run
+inline bool TestVectorOutputChunks(size_t capacity, size_t limit)
+{
+	const size_t block_count = (2 * VectorOutput<Complex>::ChunkSize + 3 * RealSimd::static_size) / RealSimd::static_size;
+	std::vector<Complex> test_input(block_count * RealSimd::static_size);
+	for (size_t i = 0; i < test_input.size(); ++i)
+		test_input[i] = Complex(Real(i % 4099), -Real(i % 4093));
+	VectorInput<Complex> input(1, test_input);
+	VectorOutput<Complex> output(1, capacity, limit);
+	output.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	bool success = true;
+	for (size_t block = 0; block < block_count; ++block) {
+		input.Update();
+		output.Update();
+		if (block == block_count / 3 || block == block_count - 1) {
+			const size_t count = (block + 1) * RealSimd::static_size;
+			const size_t begin = limit == 0 ? 0 : count - std::min(count, limit);
+			const std::vector<Complex> expected(test_input.cbegin() + begin, test_input.cbegin() + count);
+			std::vector<Complex> copied(output.Size());
+			output.CopyTo(copied.data());
+			std::vector<Complex> segments;
+			for (size_t i = 0; i < output.SegmentCount(); ++i) {
+				const VectorOutput<Complex>::Segment segment = output.GetSegment(i);
+				for (size_t j = 0; j < segment.size; ++j)
+					segments.push_back(Complex(segment.real[j], segment.imag[j]));
+			}
+			success = success && output.Count() == count && output.Size() == count - begin
+				&& copied == expected && segments == expected && output.GetStored() == expected;
+			output.ReleaseStored();
+			success = success && output.GetStored() == expected;
+		}
+	}
+	return success;
+}
+///\endcond
+
+
+/**
+ * \brief Tests the chunked storage of \ref VectorOutput<Complex>.
+ *
+ * A signal spanning several chunks has to be stored without and with a capacity hint. With a limit,
+ * only the most recent samples have to be kept, also if the limit is not a multiple of the chunk size.
+ * Copying the samples, reading them segment by segment and the vector of \ref VectorOutput::GetStored() have to agree.
+ *
+ * \returns A bool indicating if the test succeeded.
+ */
+inline bool TestVectorOutputStorage()
+{
+	return TestVectorOutputChunks(0, 0)
+		&& TestVectorOutputChunks(3 * VectorOutput<Complex>::ChunkSize, 0)
+		&& TestVectorOutputChunks(0, 1000)
+		&& TestVectorOutputChunks(1 << 20, VectorOutput<Complex>::ChunkSize + 5 * RealSimd::static_size);
+}
+
 #endif //TEST_TEST_VECTOR_IO_H_
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef TEST_TEST_WELCH_PSD_H_
+#define TEST_TEST_WELCH_PSD_H_
+
+#include <types.h>
+#include <filter/welch_psd.h>
+#include <filter/vector_input.h>
+#include <boost/math/constants/constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+/**
+ * \file test/test_welch_psd.h
+ * \brief This file contains tests for the \ref WelchPsd filter.
+ */
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Check that every averaged spectrum has its maximum at `bin` and integrates to `power`
+template<typename T>
+inline bool TestWelchPsdSignal(const std::vector<T>& test_input, double sample_rate, uint32_t bin, Real power)
+{
+	const uint32_t size = 64;
+	const uint32_t hop = 32;
+	const uint32_t average_count = 4;
+	VectorInput<T> input(sample_rate, test_input);
+	WelchPsd<T> filter(sample_rate, size, hop, average_count);
+	filter.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+	int spectra = 0;
+	for (int i = 0; i < (int)test_input.size() / RealSimd::static_size; ++i) {
+		input.Update();
+		filter.Update();
+		if (!filter.SpectrumReady())
+			continue;
+		//Skip the spectrum containing the initial zeros
+		if (spectra++ == 0)
+			continue;
+		const Real* spectrum = filter.Spectrum();
+		Real total = 0;
+		for (uint32_t k = 0; k < size; ++k)
+			total += spectrum[k] * static_cast<Real>(sample_rate / size);
+		if (std::abs(total - power) > 1e-3 * power || std::max_element(spectrum, spectrum + size) - spectrum != bin)
+			return false;
+	}
+	return spectra == (int)(test_input.size() / hop / average_count);
+}
+///\endcond
+
+
+/**
+ * \brief Test \ref WelchPsd<Real>
+ *
+ * The spectrum of a cosine with amplitude 2 has to peak at its frequency and contain a power of 2.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestWelchPsdReal()
+{
+	const double sample_rate = 6400;
+	std::vector<Real> test_input(256 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = static_cast<Real>(2 * std::cos(boost::math::constants::two_pi<double>() * 1000 * i / sample_rate));
+	return TestWelchPsdSignal(test_input, sample_rate, 10, 2);
+}
+
+
+/**
+ * \brief Test \ref WelchPsd<Complex>
+ *
+ * The spectrum of a complex exponential with negative frequency has to peak in the upper half and contain a power of 1.
+ *
+ * \returns A bool wether the test was successful.
+ */
+inline bool TestWelchPsdComplex()
+{
+	const double sample_rate = 6400;
+	std::vector<Complex> test_input(256 * RealSimd::static_size);
+	for (int i = 0; i < (int)test_input.size(); ++i)
+		test_input[i] = std::polar(Real(1), static_cast<Real>(-boost::math::constants::two_pi<double>() * 500 * i / sample_rate));
+	return TestWelchPsdSignal(test_input, sample_rate, 59, 1);
+}
+
+
+#endif //TEST_TEST_WELCH_PSD_H_
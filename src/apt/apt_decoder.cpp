@@ -0,0 +1,199 @@
+#include <apt/apt_decoder.h>
+#include <filter/riff_wave_input.h>
+#include <filter/fm_demodulator.h>
+#include <filter/correlator.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+
+
+///\cond IMPLEMENTATION_DETAILS
+//The sync patterns as words at 4160 words/s: 1 for a high word, 0 for a low word
+static const char* const SyncAPattern = "000011001100110011001100110011000000000";	//7 cycles of 1040Hz
+static const char* const SyncBPattern = "000011100111001110011100111001110011100";	//7 pulses of 832Hz
+
+//The number of words searched on each side of the expected start of a line while locked
+constexpr size_t TrackingRange = 8;
+//Every this many lines, the whole line is searched for the sync patterns even while locked
+constexpr size_t ResyncInterval = 64;
+
+//The sample rate the IQ signal is decimated to before FM demodulation
+constexpr double IntermediateRate = 40000;
+//The bandwidth of the FM modulated APT signal
+constexpr Real FmBandwidth = 34000;
+//The highest frequency of the envelope to keep
+constexpr Real EnvelopeCutoff = 2400;
+
+
+inline std::vector<Real> ZeroMeanPattern(const char* pattern)
+{
+	std::vector<Real> result;
+	for (const char* c = pattern; *c != '\0'; ++c)
+		result.push_back(*c == '1' ? Real(1) : Real(-1));
+	const Real mean = std::accumulate(result.begin(), result.end(), Real(0)) / result.size();
+	for (Real& x : result)
+		x -= mean;
+	return result;
+}
+
+//An odd number of taps, about `length` times the period of `frequency`, but at least `minimum`
+inline uint32_t OddTapcount(double sample_rate, double frequency, double length, uint32_t minimum)
+{
+	return std::max(minimum, static_cast<uint32_t>(length * sample_rate / frequency)) | 1;
+}
+///\endcond
+
+
+AptDecoder::AptDecoder(double sample_rate) :
+	analytic(sample_rate, OddTapcount(sample_rate, 400, 1, 31)),
+	envelope(sample_rate),
+	decimator(sample_rate, std::max(1u, static_cast<uint32_t>(sample_rate / (2 * WordRate))), EnvelopeCutoff, OddTapcount(sample_rate, EnvelopeCutoff, 4, 15)),
+	resample_step(decimator.SampleRateOut() / WordRate),
+	sync_a(ZeroMeanPattern(SyncAPattern)),
+	sync_b(ZeroMeanPattern(SyncBPattern))
+{
+	envelope.SetInput(0, { static_cast<const Filter*>(&analytic), 0 });
+	decimator.SetInput(0, { static_cast<const Filter*>(&envelope), 0 });
+}
+
+
+void AptDecoder::SetInput(const std::pair<const Filter*, size_t>& in)
+{
+	analytic.SetInput(0, in);
+}
+
+
+void AptDecoder::Update()
+{
+	analytic.Update();
+	envelope.Update();
+	decimator.Update();
+	if (decimator.OutputReady()) {
+		Resample();
+		ExtractLines();
+	}
+}
+
+
+void AptDecoder::Resample()
+{
+	//Linear interpolation is enough, since the decimator removed everything above the word rate
+	const Real* in = decimator.GetReal();
+	while (resample_position < RealSimd::static_size - 1) {
+		const int index = static_cast<int>(std::floor(resample_position));
+		const Real fraction = static_cast<Real>(resample_position - index);
+		const Real a = index < 0 ? last_sample : in[index];
+		const Real b = in[index + 1];
+		words.push_back(a + fraction * (b - a));
+		resample_position += resample_step;
+	}
+	resample_position -= RealSimd::static_size;
+	last_sample = in[RealSimd::static_size - 1];
+}
+
+
+void AptDecoder::ExtractLines()
+{
+	for (;;) {
+		const bool tracking = locked && LineCount() % ResyncInterval != 0;
+		const size_t count = tracking ? 2 * TrackingRange + 1 : LineLength;
+		if (search_begin + count - 1 + LineLength > words.size())
+			break;
+		const std::pair<size_t, Real> sync = FindSync(search_begin, count);
+		if (tracking && sync.second < mean_peak / 2) {
+			//Lost the signal, search the whole line again
+			locked = false;
+			continue;
+		}
+		lines.insert(lines.end(), words.begin() + sync.first, words.begin() + sync.first + LineLength);
+		mean_peak = LineCount() == 1 ? sync.second : mean_peak + (sync.second - mean_peak) / 16;
+		locked = true;
+		search_begin = sync.first + LineLength - TrackingRange;
+	}
+	//Drop the words which are not needed anymore once in a while
+	if (search_begin > 4 * LineLength) {
+		words.erase(words.begin(), words.begin() + search_begin);
+		search_begin = 0;
+	}
+}
+
+
+std::pair<size_t, Real> AptDecoder::FindSync(size_t begin, size_t count) const
+{
+	std::vector<Real> scores_a(count);
+	std::vector<Real> scores_b(count);
+	Correlate(words.data() + begin, count, sync_a, scores_a.data());
+	Correlate(words.data() + begin + LineLength / 2, count, sync_b, scores_b.data());
+	std::pair<size_t, Real> best(begin, -std::numeric_limits<Real>::infinity());
+	for (size_t i = 0; i < count; ++i)
+		if (scores_a[i] + scores_b[i] > best.second)
+			best = { begin + i, scores_a[i] + scores_b[i] };
+	return best;
+}
+
+
+std::vector<uint8_t> AptDecoder::Image() const
+{
+	std::vector<uint8_t> image(lines.size());
+	if (lines.empty())
+		return image;
+	std::vector<Real> sorted(lines);
+	const size_t clip = sorted.size() / 200;
+	std::nth_element(sorted.begin(), sorted.begin() + clip, sorted.end());
+	const Real low = sorted[clip];
+	std::nth_element(sorted.begin(), sorted.end() - 1 - clip, sorted.end());
+	const Real high = sorted[sorted.size() - 1 - clip];
+	const Real scale = high > low ? 255 / (high - low) : Real(0);
+	for (size_t i = 0; i < lines.size(); ++i)
+		image[i] = static_cast<uint8_t>(std::min(Real(255), std::max(Real(0), (lines[i] - low) * scale + Real(0.5))));
+	return image;
+}
+
+
+void AptDecoder::WritePgm(const std::string& path) const
+{
+	std::ofstream file(path, std::ios::binary);
+	if (!file.is_open())
+		throw std::runtime_error("Could not open the image file " + path + "!");
+	const std::vector<uint8_t> image = Image();
+	file << "P5\n" << LineLength << " " << LineCount() << "\n255\n";
+	file.write(reinterpret_cast<const char*>(image.data()), image.size());
+}
+
+
+std::unique_ptr<AptDecoder> DecodeAptWave(const std::string& path, AptSource source)
+{
+	std::unique_ptr<AptDecoder> decoder;
+	if (source == APT_IQ) {
+		RiffWaveInput<Complex> input(path, FILE_READ_MAPPED);
+		const uint32_t factor = std::max(1u, static_cast<uint32_t>(input.SampleRateOut() / IntermediateRate));
+		Decimator<Complex> decimator(input.SampleRateOut(), factor, FmBandwidth / 2, OddTapcount(input.SampleRateOut(), FmBandwidth / 2, 4, 31));
+		FmDemodulator<Complex> demodulator(decimator.SampleRateOut(), 0, FmBandwidth);
+		decoder.reset(new AptDecoder(demodulator.SampleRateOut()));
+		decimator.SetInput(0, { static_cast<const Filter*>(&input), 0 });
+		demodulator.SetInput(0, { static_cast<const Filter*>(&decimator), 0 });
+		decoder->SetInput({ static_cast<const Filter*>(&demodulator), 0 });
+		for (uint64_t i = 0; i < input.FrameCount() / RealSimd::static_size; ++i) {
+			input.Update();
+			decimator.Update();
+			if (decimator.OutputReady()) {
+				demodulator.Update();
+				decoder->Update();
+			}
+		}
+	}
+	else {
+		RiffWaveInput<Real> input(path, FILE_READ_MAPPED);
+		decoder.reset(new AptDecoder(input.SampleRateOut()));
+		decoder->SetInput({ static_cast<const Filter*>(&input), 0 });
+		for (uint64_t i = 0; i < input.FrameCount() / RealSimd::static_size; ++i) {
+			input.Update();
+			decoder->Update();
+		}
+	}
+	return decoder;
+}
\ No newline at end of file
@@ -8,8 +8,8 @@ template class AmplitudeModulator<Complex>;
 
 
 template<typename Tout>
-AmplitudeModulator<Tout>::AmplitudeModulator(double sample_rate, Real frequency, Real amplitude, Real phaseshift) :
-	FrequencyGenerator<Tout>(sample_rate, frequency, amplitude, phaseshift)
+AmplitudeModulator<Tout>::AmplitudeModulator(double sample_rate, Real frequency, Real amplitude, Real phaseshift, NcoMode mode) :
+	FrequencyGenerator<Tout>(sample_rate, frequency, amplitude, phaseshift, mode)
 {
 	AddInput({ nullptr, 0 });
 }
@@ -0,0 +1,42 @@
+#include <filter/analytic_signal.h>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/simd/function/load.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/assert.hpp>
+
+
+//Force the compiler to generate the Real version of AnalyticSignal
+template class AnalyticSignal<Real>;
+
+
+
+template<typename Tin>
+AnalyticSignal<Tin>::AnalyticSignal(double sample_rate, uint32_t tapcount, const std::function<Real(Real)>& window_function) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
+	half_length(tapcount / 2),
+	history(tapcount - 1 + RealSimd::static_size)
+{
+	BOOST_ASSERT_MSG(tapcount % 2 == 1, "The Hilbert transformer needs an odd number of taps!");
+	AddInput({ nullptr, 0 });
+	//The ideal Hilbert transformer has the coefficients 2/(pi*k) for odd k and 0 for even k
+	for (uint32_t k = 1; k <= half_length; k += 2) {
+		const Real window = window_function(static_cast<Real>(half_length + k) / (tapcount - 1));
+		coefficients.push_back(window * 2 / (boost::math::constants::pi<Real>() * k));
+	}
+}
+
+
+template<typename Tin>
+void AnalyticSignal<Tin>::Update()
+{
+	history.Push(GetRealInput(0));
+	//The input sample aligned with the center tap for the first output of the block
+	const Real* center = history.Data() + half_length;
+	RealSimd hilbert(0);
+	for (uint32_t i = 0; i < coefficients.size(); ++i) {
+		const uint32_t k = 2 * i + 1;
+		hilbert += RealSimd(coefficients[i]) * (boost::simd::load<RealSimd>(center - k) - boost::simd::load<RealSimd>(center + k));
+	}
+	boost::simd::aligned_store(boost::simd::load<RealSimd>(center), real());
+	boost::simd::aligned_store(hilbert, imag());
+}
\ No newline at end of file
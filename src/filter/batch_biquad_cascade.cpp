@@ -0,0 +1,58 @@
+#include <filter/batch_biquad_cascade.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <type_traits>
+
+
+//Force the compiler to generate a Real and a Complex version of BatchBiquadCascade
+template class BatchBiquadCascade<Real>;
+template class BatchBiquadCascade<Complex>;
+
+
+template<typename Tin>
+BatchBiquadCascade<Tin>::BatchBiquadCascade(double sample_rate, size_t channel_count, const std::vector<BiquadSection>& sections) :
+	BatchFilter<Tin>(sample_rate, channel_count, std::is_same<Tin, Complex>::value ? Filter::FilterOutputType::COMPLEX : Filter::FilterOutputType::REAL),
+	sections(sections),
+	state(this->GroupCount() * sections.size() * 4 * RealSimd::static_size, Real(0))
+{
+}
+
+
+template<typename Tin>
+double BatchBiquadCascade<Tin>::GroupDelay() const
+{
+	return BiquadSection::GroupDelay(sections) * this->DeltatimeIn();
+}
+
+
+template<typename Tin>
+void BatchBiquadCascade<Tin>::ProcessGroup(size_t group, Real* lanes_real, Real* lanes_imag)
+{
+	Real* group_state = state.data() + group * sections.size() * 4 * RealSimd::static_size;
+	Process(lanes_real, group_state);
+	if (std::is_same<Tin, Complex>::value)
+		Process(lanes_imag, group_state + sections.size() * 2 * RealSimd::static_size);
+}
+
+
+template<typename Tin>
+void BatchBiquadCascade<Tin>::Process(Real* lanes, Real* state) const
+{
+	constexpr size_t L = RealSimd::static_size;
+	for (const BiquadSection& section : sections) {
+		const RealSimd b0(section.b0), b1(section.b1), b2(section.b2), a1(section.a1), a2(section.a2);
+		RealSimd s1 = boost::simd::aligned_load<RealSimd>(state);
+		RealSimd s2 = boost::simd::aligned_load<RealSimd>(state + L);
+		//Every row holds one sample of all channels, so the recursion only depends on the previous row
+		for (size_t t = 0; t < L; ++t) {
+			const RealSimd x = boost::simd::aligned_load<RealSimd>(lanes + t * L);
+			const RealSimd y = b0 * x + s1;
+			s1 = b1 * x - a1 * y + s2;
+			s2 = b2 * x - a2 * y;
+			boost::simd::aligned_store(y, lanes + t * L);
+		}
+		boost::simd::aligned_store(s1, state);
+		boost::simd::aligned_store(s2, state + L);
+		state += 2 * L;
+	}
+}
@@ -0,0 +1,44 @@
+#include <filter/batch_differentiator.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <type_traits>
+
+
+//Force the compiler to generate a Real and a Complex version of BatchDifferentiator
+template class BatchDifferentiator<Real>;
+template class BatchDifferentiator<Complex>;
+
+
+template<typename Tin>
+BatchDifferentiator<Tin>::BatchDifferentiator(double sample_rate, size_t channel_count) :
+	BatchFilter<Tin>(sample_rate, channel_count, std::is_same<Tin, Complex>::value ? Filter::FilterOutputType::COMPLEX : Filter::FilterOutputType::REAL),
+	amplitude_correction_factor(sample_rate / boost::math::constants::two_pi<Real>()),
+	last_samples(this->GroupCount() * 2 * RealSimd::static_size, Real(0))
+{
+}
+
+
+template<typename Tin>
+void BatchDifferentiator<Tin>::ProcessGroup(size_t group, Real* lanes_real, Real* lanes_imag)
+{
+	Real* last = last_samples.data() + group * 2 * RealSimd::static_size;
+	Process(lanes_real, last);
+	if (std::is_same<Tin, Complex>::value)
+		Process(lanes_imag, last + RealSimd::static_size);
+}
+
+
+template<typename Tin>
+void BatchDifferentiator<Tin>::Process(Real* lanes, Real* last) const
+{
+	constexpr size_t L = RealSimd::static_size;
+	const RealSimd factor(amplitude_correction_factor);
+	RealSimd previous = boost::simd::aligned_load<RealSimd>(last);
+	for (size_t t = 0; t < L; ++t) {
+		const RealSimd x = boost::simd::aligned_load<RealSimd>(lanes + t * L);
+		boost::simd::aligned_store(factor * (x - previous), lanes + t * L);
+		previous = x;
+	}
+	boost::simd::aligned_store(previous, last);
+}
@@ -0,0 +1,83 @@
+#include <filter/batch_filter.h>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <type_traits>
+
+
+//Force the compiler to generate a Real and a Complex version of BatchFilter
+template class BatchFilter<Real>;
+template class BatchFilter<Complex>;
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Transpose the blocks of up to RealSimd::static_size channels, missing channels are 0
+inline void TransposeIn(const Real* const* channels, size_t count, Real* lanes)
+{
+	constexpr size_t L = RealSimd::static_size;
+	for (size_t k = 0; k < count; ++k)
+		for (size_t t = 0; t < L; ++t)
+			lanes[t * L + k] = channels[k][t];
+	for (size_t k = count; k < L; ++k)
+		for (size_t t = 0; t < L; ++t)
+			lanes[t * L + k] = 0;
+}
+
+inline void TransposeOut(const Real* lanes, size_t count, Real* const* channels)
+{
+	constexpr size_t L = RealSimd::static_size;
+	for (size_t k = 0; k < count; ++k)
+		for (size_t t = 0; t < L; ++t)
+			channels[k][t] = lanes[t * L + k];
+}
+///\endcond
+
+
+template<typename Tin>
+BatchFilter<Tin>::BatchFilter(double sample_rate, size_t channel_count, Filter::FilterOutputType output_type) :
+	Filter(sample_rate),
+	channel_count(channel_count),
+	output_type(output_type),
+	lanes_real(RealSimd::static_size * RealSimd::static_size),
+	lanes_imag(RealSimd::static_size * RealSimd::static_size)
+{
+	BOOST_ASSERT_MSG(channel_count > 0, "A batched filter needs at least one channel!");
+	for (size_t i = 0; i < channel_count; ++i) {
+		AddInput({ nullptr, 0 });
+		AddOutput(output_type);
+	}
+}
+
+
+template<typename Tin>
+void BatchFilter<Tin>::Update()
+{
+	const Real* in_real[RealSimd::static_size];
+	const Real* in_imag[RealSimd::static_size];
+	Real* out_real[RealSimd::static_size];
+	Real* out_imag[RealSimd::static_size];
+	for (size_t group = 0; group < GroupCount(); ++group) {
+		const size_t first = group * RealSimd::static_size;
+		const size_t count = std::min(channel_count - first, static_cast<size_t>(RealSimd::static_size));
+		for (size_t k = 0; k < count; ++k) {
+			if (std::is_same<Tin, Complex>::value) {
+				auto in = GetComplexInput(first + k);
+				in_real[k] = in.first;
+				in_imag[k] = in.second;
+			}
+			else
+				in_real[k] = GetRealInput(first + k);
+			out_real[k] = real(first + k);
+			if (output_type == Filter::FilterOutputType::COMPLEX)
+				out_imag[k] = imag(first + k);
+		}
+		TransposeIn(in_real, count, lanes_real.data());
+		if (std::is_same<Tin, Complex>::value)
+			TransposeIn(in_imag, count, lanes_imag.data());
+		else
+			std::fill(lanes_imag.begin(), lanes_imag.end(), Real(0));
+		ProcessGroup(group, lanes_real.data(), lanes_imag.data());
+		TransposeOut(lanes_real.data(), count, out_real);
+		if (output_type == Filter::FilterOutputType::COMPLEX)
+			TransposeOut(lanes_imag.data(), count, out_imag);
+	}
+}
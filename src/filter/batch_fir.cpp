@@ -0,0 +1,62 @@
+#include <filter/batch_fir.h>
+#include <filter/fir_design.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <type_traits>
+
+
+//Force the compiler to generate a Real and a Complex version of BatchFir
+template class BatchFir<Real>;
+template class BatchFir<Complex>;
+
+
+template<typename Tin>
+BatchFir<Tin>::BatchFir(double sample_rate, size_t channel_count, const std::vector<Real>& coeff) :
+	BatchFilter<Tin>(sample_rate, channel_count, std::is_same<Tin, Complex>::value ? Filter::FilterOutputType::COMPLEX : Filter::FilterOutputType::REAL),
+	coeff(coeff)
+{
+	BOOST_ASSERT_MSG(!coeff.empty(), "A FIR filter needs at least one coefficient!");
+	history.assign(this->GroupCount() * (std::is_same<Tin, Complex>::value ? 2 : 1) * RowsSize(), Real(0));
+	blocks.assign(this->GroupCount(), 0);
+}
+
+
+template<typename Tin>
+double BatchFir<Tin>::GroupDelay() const
+{
+	return FirGroupDelay(coeff) * this->DeltatimeIn();
+}
+
+
+template<typename Tin>
+void BatchFir<Tin>::ProcessGroup(size_t group, Real* lanes_real, Real* lanes_imag)
+{
+	Real* rows = history.data() + group * (std::is_same<Tin, Complex>::value ? 2 : 1) * RowsSize();
+	Process(lanes_real, rows, blocks[group]);
+	if (std::is_same<Tin, Complex>::value)
+		Process(lanes_imag, rows + RowsSize(), blocks[group]);
+	blocks[group] = (blocks[group] + 1) % HistoryBlocks();
+}
+
+
+template<typename Tin>
+void BatchFir<Tin>::Process(Real* lanes, Real* rows, size_t block_index) const
+{
+	constexpr size_t L = RealSimd::static_size;
+	const size_t taps = coeff.size();
+	Real* block = rows + (taps - 1 + block_index * L) * L;
+	std::copy(lanes, lanes + L * L, block);
+	for (size_t t = 0; t < L; ++t) {
+		//y[t] = sum(coeff[k] * x[t-k]) for all channels at once, x[t-k] is the row k rows before the current one
+		const Real* x = block + t * L;
+		RealSimd sum(0);
+		for (size_t k = 0; k < taps; ++k)
+			sum += RealSimd(coeff[k]) * boost::simd::aligned_load<RealSimd>(x - k * L);
+		boost::simd::aligned_store(sum, lanes + t * L);
+	}
+	//Once the room for the blocks is used up, the last taps-1 rows are moved back for the next block
+	if (block_index + 1 == HistoryBlocks())
+		std::copy(rows + RowsSize() - (taps - 1) * L, rows + RowsSize(), rows);
+}
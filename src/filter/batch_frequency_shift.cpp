@@ -0,0 +1,43 @@
+#include <filter/batch_frequency_shift.h>
+#include <filter/nco.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/simd/function/sincospi.hpp>
+
+
+//Force the compiler to generate a Real and a Complex version of BatchFrequencyShift
+template class BatchFrequencyShift<Real>;
+template class BatchFrequencyShift<Complex>;
+
+
+template<typename Tin>
+BatchFrequencyShift<Tin>::BatchFrequencyShift(double sample_rate, const std::vector<Real>& shifts) :
+	BatchFilter<Tin>(sample_rate, shifts.size(), Filter::FilterOutputType::COMPLEX),
+	phase(this->GroupCount() * RealSimd::static_size, 0),
+	increment(this->GroupCount() * RealSimd::static_size, 0)
+{
+	for (size_t i = 0; i < shifts.size(); ++i)
+		increment[i] = Nco::CyclesToPhase(shifts[i] / sample_rate);
+}
+
+
+template<typename Tin>
+void BatchFrequencyShift<Tin>::ProcessGroup(size_t group, Real* lanes_real, Real* lanes_imag)
+{
+	constexpr size_t L = RealSimd::static_size;
+	uint64_t* group_phase = phase.data() + group * L;
+	const uint64_t* group_increment = increment.data() + group * L;
+	alignas(RealSimd::alignment) Real phase_div_pi[L];
+	for (size_t t = 0; t < L; ++t) {
+		for (size_t k = 0; k < L; ++k) {
+			phase_div_pi[k] = static_cast<Real>(group_phase[k] * (1.0 / 9223372036854775808.0));	// 2^63 is half a period
+			group_phase[k] += group_increment[k];
+		}
+		const auto exp = boost::simd::sincospi(boost::simd::aligned_load<RealSimd>(phase_div_pi));
+		const RealSimd re = boost::simd::aligned_load<RealSimd>(lanes_real + t * L);
+		const RealSimd im = boost::simd::aligned_load<RealSimd>(lanes_imag + t * L);
+		//The imaginary part of a Real input is 0
+		boost::simd::aligned_store(exp.second * re - exp.first * im, lanes_real + t * L);
+		boost::simd::aligned_store(exp.first * re + exp.second * im, lanes_imag + t * L);
+	}
+}
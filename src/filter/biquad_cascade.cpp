@@ -0,0 +1,349 @@
+#include <filter/biquad_cascade.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
+#include <complex>
+
+
+//Force the compiler to generate a Real and a Complex version of BiquadCascade
+template class BiquadCascade<Real>;
+template class BiquadCascade<Complex>;
+
+
+static_assert(RealSimd::static_size >= 2, "The block state space formulation of BiquadCascade needs at least two samples per block!");
+
+
+
+//---------- BiquadSection Implementation ----------//
+
+///\cond IMPLEMENTATION_DETAILS
+namespace
+{
+	/**
+	 * \brief A section of an analog prototype filter.
+	 *
+	 * `H(s) = (B2*s^2 + B1*s + B0) / (A2*s^2 + A1*s + A0)` with `s` normalized to the cutoff frequency.
+	 */
+	struct AnalogSection
+	{
+		double B0, B1, B2;
+		double A0, A1, A2;
+	};
+
+
+	//Transform a low pass prototype section into a high pass prototype section (s -> 1/s)
+	AnalogSection LowToHighPass(const AnalogSection& s)
+	{
+		if (s.A2 != 0)
+			return AnalogSection{ s.B2, s.B1, s.B0, s.A2, s.A1, s.A0 };
+		return AnalogSection{ s.B1, s.B0, 0, s.A1, s.A0, 0 };
+	}
+
+
+	//Map an analog section to the z-plane with the bilinear transform, prewarped to the cutoff frequency
+	BiquadSection Bilinear(const AnalogSection& s, double sample_rate, double cutoff_frequency)
+	{
+		const double K = 1.0 / std::tan(boost::math::constants::pi<double>() * cutoff_frequency / sample_rate);
+		const double K2 = K * K;
+		const double n0 = s.B2 * K2 + s.B1 * K + s.B0;
+		const double n1 = 2 * (s.B0 - s.B2 * K2);
+		const double n2 = s.B2 * K2 - s.B1 * K + s.B0;
+		const double d0 = s.A2 * K2 + s.A1 * K + s.A0;
+		const double d1 = 2 * (s.A0 - s.A2 * K2);
+		const double d2 = s.A2 * K2 - s.A1 * K + s.A0;
+		return BiquadSection{ Real(n0 / d0), Real(n1 / d0), Real(n2 / d0), Real(d1 / d0), Real(d2 / d0) };
+	}
+
+
+	//The sections of a normalized Butterworth low pass prototype
+	std::vector<AnalogSection> ButterworthPrototype(uint32_t order)
+	{
+		std::vector<AnalogSection> sections;
+		for (uint32_t k = 0; k < order / 2; ++k) {
+			const double angle = boost::math::constants::pi<double>() * (2 * k + 1) / (2 * order);
+			sections.push_back(AnalogSection{ 1, 0, 0, 1, 2 * std::sin(angle), 1 });
+		}
+		if (order % 2 == 1)
+			sections.push_back(AnalogSection{ 1, 0, 0, 1, 1, 0 });
+		return sections;
+	}
+
+
+	//The sections of a normalized Chebyshev type I low pass prototype
+	std::vector<AnalogSection> ChebyshevPrototype(uint32_t order, double ripple)
+	{
+		const double epsilon = std::sqrt(std::pow(10.0, ripple / 10) - 1);
+		const double v = std::asinh(1 / epsilon) / order;
+		std::vector<AnalogSection> sections;
+		for (uint32_t k = 0; k < order / 2; ++k) {
+			const double angle = boost::math::constants::pi<double>() * (2 * k + 1) / (2 * order);
+			const double sigma = -std::sinh(v) * std::sin(angle);
+			const double omega = std::cosh(v) * std::cos(angle);
+			const double magnitude2 = sigma * sigma + omega * omega;
+			sections.push_back(AnalogSection{ magnitude2, 0, 0, magnitude2, -2 * sigma, 1 });
+		}
+		if (order % 2 == 1) {
+			const double sigma = -std::sinh(v);
+			sections.push_back(AnalogSection{ -sigma, 0, 0, -sigma, 1, 0 });
+		}
+		//Even orders start at the bottom of the ripple band at DC
+		else if (!sections.empty())
+			sections.front().B0 /= std::sqrt(1 + epsilon * epsilon);
+		return sections;
+	}
+
+
+	std::vector<BiquadSection> Digitize(const std::vector<AnalogSection>& prototype, double sample_rate, double cutoff_frequency, bool high_pass)
+	{
+		std::vector<BiquadSection> sections;
+		for (const AnalogSection& s : prototype)
+			sections.push_back(Bilinear(high_pass ? LowToHighPass(s) : s, sample_rate, cutoff_frequency));
+		return sections;
+	}
+}
+///\endcond
+
+
+std::vector<BiquadSection> BiquadSection::ButterworthLowPass(double sample_rate, Real cutoff_frequency, uint32_t order)
+{
+	return Digitize(ButterworthPrototype(order), sample_rate, cutoff_frequency, false);
+}
+
+
+std::vector<BiquadSection> BiquadSection::ButterworthHighPass(double sample_rate, Real cutoff_frequency, uint32_t order)
+{
+	return Digitize(ButterworthPrototype(order), sample_rate, cutoff_frequency, true);
+}
+
+
+std::vector<BiquadSection> BiquadSection::ChebyshevLowPass(double sample_rate, Real cutoff_frequency, uint32_t order, Real ripple)
+{
+	return Digitize(ChebyshevPrototype(order, ripple), sample_rate, cutoff_frequency, false);
+}
+
+
+std::vector<BiquadSection> BiquadSection::ChebyshevHighPass(double sample_rate, Real cutoff_frequency, uint32_t order, Real ripple)
+{
+	return Digitize(ChebyshevPrototype(order, ripple), sample_rate, cutoff_frequency, true);
+}
+
+
+std::vector<BiquadSection> BiquadSection::Notch(double sample_rate, Real frequency, Real q)
+{
+	const double w0 = boost::math::constants::two_pi<double>() * frequency / sample_rate;
+	const double alpha = std::sin(w0) / (2 * q);
+	const double a0 = 1 + alpha;
+	return { BiquadSection{ Real(1 / a0), Real(-2 * std::cos(w0) / a0), Real(1 / a0), Real(-2 * std::cos(w0) / a0), Real((1 - alpha) / a0) } };
+}
+
+
+std::vector<BiquadSection> BiquadSection::LowShelf(double sample_rate, Real frequency, Real gain, Real q)
+{
+	const double A = std::pow(10.0, gain / 40);
+	const double w0 = boost::math::constants::two_pi<double>() * frequency / sample_rate;
+	const double cos_w0 = std::cos(w0);
+	const double beta = 2 * std::sqrt(A) * std::sin(w0) / (2 * q);
+	const double a0 = (A + 1) + (A - 1) * cos_w0 + beta;
+	return { BiquadSection{
+		Real(A * ((A + 1) - (A - 1) * cos_w0 + beta) / a0),
+		Real(2 * A * ((A - 1) - (A + 1) * cos_w0) / a0),
+		Real(A * ((A + 1) - (A - 1) * cos_w0 - beta) / a0),
+		Real(-2 * ((A - 1) + (A + 1) * cos_w0) / a0),
+		Real(((A + 1) + (A - 1) * cos_w0 - beta) / a0) } };
+}
+
+
+std::vector<BiquadSection> BiquadSection::HighShelf(double sample_rate, Real frequency, Real gain, Real q)
+{
+	const double A = std::pow(10.0, gain / 40);
+	const double w0 = boost::math::constants::two_pi<double>() * frequency / sample_rate;
+	const double cos_w0 = std::cos(w0);
+	const double beta = 2 * std::sqrt(A) * std::sin(w0) / (2 * q);
+	const double a0 = (A + 1) - (A - 1) * cos_w0 + beta;
+	return { BiquadSection{
+		Real(A * ((A + 1) + (A - 1) * cos_w0 + beta) / a0),
+		Real(-2 * A * ((A - 1) + (A + 1) * cos_w0) / a0),
+		Real(A * ((A + 1) + (A - 1) * cos_w0 - beta) / a0),
+		Real(2 * ((A - 1) - (A + 1) * cos_w0) / a0),
+		Real(((A + 1) - (A - 1) * cos_w0 - beta) / a0) } };
+}
+
+
+std::vector<BiquadSection> BiquadSection::DcBlocker(double sample_rate, Real cutoff_frequency)
+{
+	return ButterworthHighPass(sample_rate, cutoff_frequency, 1);
+}
+
+
+std::vector<BiquadSection> BiquadSection::Deemphasis(double sample_rate, Real time_constant)
+{
+	return ButterworthLowPass(sample_rate, Real(1 / (boost::math::constants::two_pi<double>() * time_constant)), 1);
+}
+
+
+
+///\cond IMPLEMENTATION_DETAILS
+namespace
+{
+	//The value of the polynomial c0 + c1*z^-1 + c2*z^-2 at z = exp(j*omega)
+	std::complex<double> Polynomial(double c0, double c1, double c2, double omega)
+	{
+		const std::complex<double> z1 = std::polar(1.0, -omega);
+		return c0 + c1 * z1 + c2 * z1 * z1;
+	}
+
+	//The group delay of the polynomial is Re(sum(n*c[n]*z^-n) / sum(c[n]*z^-n)), fails if the polynomial vanishes
+	bool PolynomialGroupDelay(double c0, double c1, double c2, double omega, double& delay)
+	{
+		const std::complex<double> value = Polynomial(c0, c1, c2, omega);
+		if (std::abs(value) <= 1e-6 * (std::abs(c0) + std::abs(c1) + std::abs(c2)))
+			return false;
+		const std::complex<double> z1 = std::polar(1.0, -omega);
+		delay = std::real((c1 * z1 + 2.0 * c2 * z1 * z1) / value);
+		return true;
+	}
+
+	//The group delay of all sections at the same frequency, fails if any numerator or denominator vanishes there
+	bool CascadeGroupDelay(const std::vector<BiquadSection>& sections, double omega, double& delay)
+	{
+		delay = 0;
+		for (const BiquadSection& s : sections) {
+			double numerator, denominator;
+			if (!PolynomialGroupDelay(s.b0, s.b1, s.b2, omega, numerator) || !PolynomialGroupDelay(1, s.a1, s.a2, omega, denominator))
+				return false;
+			delay += numerator - denominator;
+		}
+		return true;
+	}
+}
+///\endcond
+
+
+double BiquadSection::GroupDelay(const std::vector<BiquadSection>& sections)
+{
+	//Evaluate at DC, or at the nyquist frequency if a section blocks DC
+	double delay;
+	if (CascadeGroupDelay(sections, 0, delay) || CascadeGroupDelay(sections, boost::math::constants::pi<double>(), delay))
+		return delay;
+	//A band pass blocks both, so evaluate at the peak of the magnitude response instead
+	constexpr int grid_size = 512;
+	double peak_omega = 0, peak_magnitude = -1;
+	for (int i = 1; i < grid_size; ++i) {
+		const double omega = boost::math::constants::pi<double>() * i / grid_size;
+		double magnitude = 1;
+		for (const BiquadSection& s : sections)
+			magnitude *= std::abs(Polynomial(s.b0, s.b1, s.b2, omega)) / std::abs(Polynomial(1, s.a1, s.a2, omega));
+		if (magnitude > peak_magnitude) {
+			peak_magnitude = magnitude;
+			peak_omega = omega;
+		}
+	}
+	return CascadeGroupDelay(sections, peak_omega, delay) ? delay : 0;
+}
+
+
+
+//---------- BiquadCascade Implementation ----------//
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+BiquadCascade<Real>::BiquadCascade(double sample_rate, const std::vector<BiquadSection>& sections) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL)),
+	sections(sections),
+	state_real(2 * sections.size(), Real(0))
+{
+	AddInput({ nullptr, 0 });
+	InitBlockCoefficients();
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+BiquadCascade<Complex>::BiquadCascade(double sample_rate, const std::vector<BiquadSection>& sections) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
+	sections(sections),
+	state_real(2 * sections.size(), Real(0)),
+	state_imag(2 * sections.size(), Real(0))
+{
+	AddInput({ nullptr, 0 });
+	InitBlockCoefficients();
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void BiquadCascade<Real>::Update()
+{
+	Process(GetRealInput(0), real(), state_real);
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void BiquadCascade<Complex>::Update()
+{
+	auto in = GetComplexInput(0);
+	Process(in.first, real(), state_real);
+	Process(in.second, imag(), state_imag);
+}
+///\endcond
+
+
+template<typename Tin>
+double BiquadCascade<Tin>::GroupDelay() const
+{
+	return BiquadSection::GroupDelay(sections) * DeltatimeIn();
+}
+
+
+template<typename Tin>
+void BiquadCascade<Tin>::InitBlockCoefficients()
+{
+	constexpr int L = RealSimd::static_size;
+	block_coefficients.assign(sections.size() * (L + 2) * L, Real(0));
+	for (int s = 0; s < (int)sections.size(); ++s) {
+		const BiquadSection& c = sections[s];
+		//Run the recursion once for every state variable and every input sample set to one
+		for (int column = 0; column < L + 2; ++column) {
+			Real s1 = column == 0 ? Real(1) : Real(0);
+			Real s2 = column == 1 ? Real(1) : Real(0);
+			for (int i = 0; i < L; ++i) {
+				const Real x = column - 2 == i ? Real(1) : Real(0);
+				const Real y = c.b0 * x + s1;
+				s1 = c.b1 * x - c.a1 * y + s2;
+				s2 = c.b2 * x - c.a2 * y;
+				block_coefficients[(s * (L + 2) + column) * L + i] = y;
+			}
+		}
+	}
+}
+
+
+template<typename Tin>
+void BiquadCascade<Tin>::Process(const Real* in, Real* out, std::vector<Real>& state) const
+{
+	constexpr int L = RealSimd::static_size;
+	alignas(RealSimd::alignment) Real samples[L];
+	for (int i = 0; i < L; ++i)
+		samples[i] = in[i];
+	for (int s = 0; s < (int)sections.size(); ++s) {
+		const Real* columns = &block_coefficients[s * (L + 2) * L];
+		//The outputs are a linear combination of the state variables and the inputs of the block
+		RealSimd y = boost::simd::aligned_load<RealSimd>(columns) * RealSimd(state[2 * s]);
+		y += boost::simd::aligned_load<RealSimd>(columns + L) * RealSimd(state[2 * s + 1]);
+		for (int i = 0; i < L; ++i)
+			y += boost::simd::aligned_load<RealSimd>(columns + (i + 2) * L) * RealSimd(samples[i]);
+		//The state at the end of the block only depends on the last two samples
+		const BiquadSection& c = sections[s];
+		const Real x_last = samples[L - 1];
+		const Real x_prev = samples[L - 2];
+		boost::simd::aligned_store(y, samples);
+		state[2 * s] = c.b1 * x_last - c.a1 * samples[L - 1] + c.b2 * x_prev - c.a2 * samples[L - 2];
+		state[2 * s + 1] = c.b2 * x_last - c.a2 * samples[L - 1];
+	}
+	boost::simd::aligned_store(boost::simd::aligned_load<RealSimd>(samples), out);
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include <filter/correlator.h>
+#include <utils.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/simd/function/load.hpp>
+#include <boost/simd/function/store.hpp>
+#include <boost/simd/function/maximum.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+
+
+//Force the compiler to generate the Real version of Correlator
+template class Correlator<Real>;
+
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Patterns longer than this are correlated via FFT in CORRELATOR_AUTO mode
+constexpr size_t CorrelatorFftThreshold = 128;
+
+inline CorrelatorMethod ChooseCorrelatorMethod(CorrelatorMethod method, size_t pattern_size)
+{
+	if (method != CORRELATOR_AUTO)
+		return method;
+	return pattern_size > CorrelatorFftThreshold ? CORRELATOR_FFT : CORRELATOR_DIRECT;
+}
+
+//The FFT is four times as long as the pattern, so about three quarters of its outputs are usable
+inline size_t CorrelatorFftSize(size_t pattern_size)
+{
+	size_t size = 64;
+	while (size < 4 * pattern_size)
+		size *= 2;
+	return size;
+}
+///\endcond
+
+
+void Correlate(const Real* samples, size_t count, const std::vector<Real>& pattern, Real* out)
+{
+	size_t i = 0;
+	for (; i + RealSimd::static_size <= count; i += RealSimd::static_size) {
+		RealSimd sum(0);
+		for (size_t k = 0; k < pattern.size(); ++k)
+			sum += RealSimd(pattern[k]) * boost::simd::load<RealSimd>(samples + i + k);
+		boost::simd::store(sum, out + i);
+	}
+	for (; i < count; ++i) {
+		Real sum = 0;
+		for (size_t k = 0; k < pattern.size(); ++k)
+			sum += pattern[k] * samples[i + k];
+		out[i] = sum;
+	}
+}
+
+
+template<typename Tin>
+Correlator<Tin>::Correlator(double sample_rate, const std::vector<Real>& pattern, Real threshold, uint32_t min_distance, CorrelatorMethod method) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL)),
+	pattern(pattern),
+	method(ChooseCorrelatorMethod(method, pattern.size())),
+	threshold(threshold),
+	min_distance(min_distance == 0 ? static_cast<uint32_t>(pattern.size()) : min_distance),
+	history(ChooseCorrelatorMethod(method, pattern.size()) == CORRELATOR_FFT ? CorrelatorFftSize(pattern.size()) : pattern.size() - 1 + RealSimd::static_size)
+{
+	BOOST_ASSERT_MSG(!pattern.empty(), "The pattern must not be empty!");
+	AddInput({ nullptr, 0 });
+	if (this->method == CORRELATOR_FFT) {
+		fft = FftPlan::Get(CorrelatorFftSize(pattern.size()));
+		const size_t fft_size = fft->Size();
+		fft_step = floorto<size_t>(RealSimd::static_size, fft_size - pattern.size() + 1);
+		pattern_real.assign(fft_size, Real(0));
+		pattern_imag.assign(fft_size, Real(0));
+		std::copy(pattern.cbegin(), pattern.cend(), pattern_real.begin());
+		fft->Forward(pattern_real.data(), pattern_imag.data());
+		//Conjugate for the correlation and fold in the normalization of the inverse FFT
+		for (size_t i = 0; i < fft_size; ++i) {
+			pattern_real[i] /= fft_size;
+			pattern_imag[i] /= -Real(fft_size);
+		}
+		fft_real.assign(fft_size, Real(0));
+		fft_imag.assign(fft_size, Real(0));
+		fft_scores.assign(fft_step, Real(0));
+	}
+}
+
+
+template<typename Tin>
+void Correlator<Tin>::Update()
+{
+	history.Push(GetRealInput(0));
+	if (method == CORRELATOR_DIRECT) {
+		Correlate(history.Data(), RealSimd::static_size, pattern, real());
+		FindPeaks(sample_count);
+	}
+	else {
+		//Put out the scores of the previous FFT before they get replaced
+		boost::simd::aligned_store(boost::simd::aligned_load<RealSimd>(fft_scores.data() + fft_position), real());
+		fft_position += RealSimd::static_size;
+		FindPeaks(sample_count - static_cast<int64_t>(fft_step));
+		if (fft_position == fft_step) {
+			CorrelateFft();
+			fft_position = 0;
+		}
+	}
+	sample_count += RealSimd::static_size;
+}
+
+
+template<typename Tin>
+void Correlator<Tin>::CorrelateFft()
+{
+	//Circular cross correlation of the window with the pattern. The last fft_step offsets don't wrap around.
+	const size_t fft_size = fft->Size();
+	std::copy(history.Data(), history.Data() + fft_size, fft_real.begin());
+	std::fill(fft_imag.begin(), fft_imag.end(), Real(0));
+	fft->Forward(fft_real.data(), fft_imag.data());
+	for (size_t i = 0; i < fft_size; i += RealSimd::static_size) {
+		const RealSimd x_real = boost::simd::aligned_load<RealSimd>(fft_real.data() + i);
+		const RealSimd x_imag = boost::simd::aligned_load<RealSimd>(fft_imag.data() + i);
+		const RealSimd p_real = boost::simd::aligned_load<RealSimd>(pattern_real.data() + i);
+		const RealSimd p_imag = boost::simd::aligned_load<RealSimd>(pattern_imag.data() + i);
+		boost::simd::aligned_store(x_real * p_real - x_imag * p_imag, fft_real.data() + i);
+		boost::simd::aligned_store(x_real * p_imag + x_imag * p_real, fft_imag.data() + i);
+	}
+	fft->Inverse(fft_real.data(), fft_imag.data());
+	const size_t first = fft_size - pattern.size() + 1 - fft_step;
+	std::copy(fft_real.cbegin() + first, fft_real.cbegin() + first + fft_step, fft_scores.begin());
+}
+
+
+template<typename Tin>
+void Correlator<Tin>::FindPeaks(int64_t first)
+{
+	const Real* scores = real();
+	//Most blocks contain no score above the threshold
+	if (!has_candidate && boost::simd::maximum(boost::simd::aligned_load<RealSimd>(scores)) < threshold)
+		return;
+	for (size_t i = 0; i < RealSimd::static_size; ++i) {
+		const int64_t start = first + static_cast<int64_t>(i) - static_cast<int64_t>(pattern.size() - 1);
+		if (has_candidate && start - candidate.index > min_distance) {
+			peaks.push_back(candidate);
+			has_candidate = false;
+		}
+		//Ignore the scores of patterns starting before the first input sample
+		if (start >= 0 && scores[i] >= threshold && (!has_candidate || scores[i] > candidate.score)) {
+			candidate = { start, scores[i] };
+			has_candidate = true;
+		}
+	}
+}
+
+
+template<typename Tin>
+std::vector<CorrelationPeak> Correlator<Tin>::TakePeaks(bool final)
+{
+	if (final && has_candidate) {
+		peaks.push_back(candidate);
+		has_candidate = false;
+	}
+	std::vector<CorrelationPeak> result;
+	result.swap(peaks);
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <filter/decimator.h>
+#include <filter/fir_design.h>
+#include <utils.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/load.hpp>
+#include <boost/simd/function/sum.hpp>
+#include <boost/assert.hpp>
+#include <type_traits>
+
+
+//Force the compiler to generate a Real and a Complex version of Decimator
+template class Decimator<Real>;
+template class Decimator<Complex>;
+
+
+
+///\cond IMPLEMENTATION_DETAILS
+//The number of taps rounded up to a whole number of SIMD registers
+inline uint32_t PaddedTapcount(uint32_t tapcount)
+{
+	return ceilto<uint32_t>(RealSimd::static_size, tapcount);
+}
+///\endcond
+
+
+template<typename Tin>
+Decimator<Tin>::Decimator(double sample_rate, uint32_t factor, Real cutoff_frequency, uint32_t tapcount, const std::function<Real(Real)>& window_function) :
+	Filter(sample_rate, factor, std::vector<Filter::FilterOutputType>(1, std::is_same<Tin, Complex>::value ? Filter::FilterOutputType::COMPLEX : Filter::FilterOutputType::REAL)),
+	tapcount(tapcount),
+	coefficients(PaddedTapcount(tapcount), Real(0)),
+	history_real(PaddedTapcount(tapcount) - 1 + factor * RealSimd::static_size),
+	history_imag(std::is_same<Tin, Complex>::value ? PaddedTapcount(tapcount) - 1 + factor * RealSimd::static_size : RealSimd::static_size)
+{
+	BOOST_ASSERT_MSG(factor >= 1, "The decimation factor has to be at least 1!");
+	BOOST_ASSERT_MSG(tapcount >= 2, "The anti aliasing filter needs at least 2 taps!");
+	AddInput({ nullptr, 0 });
+	const std::vector<Real> low_pass = LowPassCoefficients(sample_rate, cutoff_frequency, tapcount, window_function);
+	Real gain = 0;
+	for (uint32_t i = 0; i < tapcount; ++i) {
+		coefficients[coefficients.size() - 1 - i] = low_pass[i];
+		gain += low_pass[i];
+	}
+	//Normalize to unity gain at DC
+	for (Real& coeff : coefficients)
+		coeff /= gain;
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void Decimator<Real>::Update()
+{
+	history_real.Push(GetRealInput(0));
+	output_ready = ++block_count == DecimationFactor();
+	if (output_ready) {
+		block_count = 0;
+		Decimate(history_real, real());
+	}
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void Decimator<Complex>::Update()
+{
+	auto in = GetComplexInput(0);
+	history_real.Push(in.first);
+	history_imag.Push(in.second);
+	output_ready = ++block_count == DecimationFactor();
+	if (output_ready) {
+		block_count = 0;
+		Decimate(history_real, real());
+		Decimate(history_imag, imag());
+	}
+}
+///\endcond
+
+
+template<typename Tin>
+void Decimator<Tin>::Decimate(const SampleHistory& history, Real* out) const
+{
+	//The window ends with the last `factor` blocks. The newest sample weighed for output j is their sample j*factor.
+	for (uint32_t j = 0; j < RealSimd::static_size; ++j) {
+		const Real* samples = history.Data() + j * DecimationFactor();
+		RealSimd sum(0);
+		for (uint32_t i = 0; i < coefficients.size(); i += RealSimd::static_size)
+			sum += boost::simd::aligned_load<RealSimd>(coefficients.data() + i) * boost::simd::load<RealSimd>(samples + i);
+		out[j] = boost::simd::sum(sum);
+	}
+}
\ No newline at end of file
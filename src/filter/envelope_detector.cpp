@@ -0,0 +1,41 @@
+#include <filter/envelope_detector.h>
+#include <boost/simd/function/abs.hpp>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/simd/function/sqrt.hpp>
+
+
+//Force the compiler to generate a Real and a Complex version of EnvelopeDetector
+template class EnvelopeDetector<Real>;
+template class EnvelopeDetector<Complex>;
+
+
+
+template<typename Tin>
+EnvelopeDetector<Tin>::EnvelopeDetector(double sample_rate) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL))
+{
+	AddInput({ nullptr, 0 });
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void EnvelopeDetector<Real>::Update()
+{
+	const RealSimd in = boost::simd::aligned_load<RealSimd>(GetRealInput(0));
+	boost::simd::aligned_store(boost::simd::abs(in), real());
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void EnvelopeDetector<Complex>::Update()
+{
+	auto in = GetComplexInput(0);
+	const RealSimd re = boost::simd::aligned_load<RealSimd>(in.first);
+	const RealSimd im = boost::simd::aligned_load<RealSimd>(in.second);
+	boost::simd::aligned_store(boost::simd::sqrt(re * re + im * im), real());
+}
+///\endcond
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <filter/external_buffer_input.h>
+#include <io/sample_conversion.h>
+#include <algorithm>
+#include <type_traits>
+
+
+//Force the compiler to generate a Real and a Complex version of ExternalBufferInput
+template class ExternalBufferInput<Real>;
+template class ExternalBufferInput<Complex>;
+
+
+template<typename Tout>
+ExternalBufferInput<Tout>::ExternalBufferInput(double sample_rate, const ExternalBuffer<const Real>& buffer, ExternalBufferLayout layout,
+	const ExternalBufferCallback<const Real>& refill) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, std::is_same<Tout, Complex>::value ? Filter::FilterOutputType::COMPLEX : Filter::FilterOutputType::REAL)),
+	buffer(buffer),
+	layout(layout),
+	refill(refill)
+{
+}
+
+
+template<typename Tout>
+void ExternalBufferInput<Tout>::Update()
+{
+	size_t filled = 0;
+	while (filled < RealSimd::static_size) {
+		if (position == buffer.size) {
+			if (end_of_data || !refill || !refill(buffer)) {
+				end_of_data = true;
+				std::fill(real() + filled, real() + RealSimd::static_size, Real(0));
+				if (std::is_same<Tout, Complex>::value)
+					std::fill(imag() + filled, imag() + RealSimd::static_size, Real(0));
+				return;
+			}
+			position = 0;
+			continue;
+		}
+		//A block only needs two copies if it spans the end of a buffer
+		const size_t count = std::min(RealSimd::static_size - filled, buffer.size - position);
+		Copy(filled, count);
+		position += count;
+		filled += count;
+	}
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void ExternalBufferInput<Real>::Copy(size_t offset, size_t count)
+{
+	std::copy(buffer.real + position, buffer.real + position + count, real() + offset);
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void ExternalBufferInput<Complex>::Copy(size_t offset, size_t count)
+{
+	if (layout == EXTERNAL_BUFFER_SPLIT) {
+		std::copy(buffer.real + position, buffer.real + position + count, real() + offset);
+		std::copy(buffer.imag + position, buffer.imag + position + count, imag() + offset);
+	}
+	else {
+		Real* const channels[] = { real() + offset, imag() + offset };
+		DeinterleaveSamples<Real>(reinterpret_cast<const uint8_t*>(buffer.real + 2 * position), count, 2, Real(1), channels);
+	}
+}
+///\endcond
@@ -0,0 +1,92 @@
+#include <filter/external_buffer_output.h>
+#include <io/sample_conversion.h>
+#include <algorithm>
+
+
+//Force the compiler to generate a Real and a Complex version of ExternalBufferOutput
+template class ExternalBufferOutput<Real>;
+template class ExternalBufferOutput<Complex>;
+
+
+template<typename Tin>
+ExternalBufferOutput<Tin>::ExternalBufferOutput(double sample_rate, const ExternalBuffer<Real>& buffer, ExternalBufferLayout layout,
+	const ExternalBufferCallback<Real>& flush) :
+	Filter(sample_rate),
+	buffer(buffer),
+	layout(layout),
+	flush(flush)
+{
+	AddInput({ nullptr, 0 });
+}
+
+
+template<typename Tin>
+void ExternalBufferOutput<Tin>::Update()
+{
+	if (end_of_data)
+		return;
+	size_t done = 0;
+	while (done < RealSimd::static_size) {
+		//Only an empty buffer is left without handing it over
+		if (position == buffer.size) {
+			Flush();
+			if (end_of_data)
+				return;
+			continue;
+		}
+		const size_t count = std::min(RealSimd::static_size - done, buffer.size - position);
+		Copy(done, count);
+		position += count;
+		done += count;
+		if (position == buffer.size) {
+			Flush();
+			if (end_of_data)
+				return;
+		}
+	}
+}
+
+
+template<typename Tin>
+void ExternalBufferOutput<Tin>::Flush()
+{
+	if (end_of_data)
+		return;
+	if (!flush) {
+		end_of_data = true;
+		return;
+	}
+	buffer.size = position;
+	position = 0;
+	end_of_data = !flush(buffer);
+	//The buffer belongs to the caller again, so nothing must be written to it anymore
+	if (end_of_data)
+		buffer = ExternalBuffer<Real>();
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void ExternalBufferOutput<Real>::Copy(size_t offset, size_t count)
+{
+	const Real* in = GetRealInput(0);
+	std::copy(in + offset, in + offset + count, buffer.real + position);
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void ExternalBufferOutput<Complex>::Copy(size_t offset, size_t count)
+{
+	auto in = GetComplexInput(0);
+	if (layout == EXTERNAL_BUFFER_SPLIT) {
+		std::copy(in.first + offset, in.first + offset + count, buffer.real + position);
+		std::copy(in.second + offset, in.second + offset + count, buffer.imag + position);
+	}
+	else {
+		const Real* const channels[] = { in.first + offset, in.second + offset };
+		InterleaveSamples<Real>(channels, count, 2, Real(1), reinterpret_cast<uint8_t*>(buffer.real + 2 * position));
+	}
+}
+///\endcond
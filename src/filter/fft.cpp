@@ -0,0 +1,96 @@
+#include <filter/fft.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <utility>
+
+
+
+std::shared_ptr<const FftPlan> FftPlan::Get(size_t size)
+{
+	static std::mutex mutex;
+	static std::map<size_t, std::shared_ptr<const FftPlan>> plans;
+	std::lock_guard<std::mutex> lock(mutex);
+	std::shared_ptr<const FftPlan>& plan = plans[size];
+	if (!plan)
+		plan.reset(new FftPlan(size));
+	return plan;
+}
+
+
+FftPlan::FftPlan(size_t size) :
+	size(size),
+	twiddle_real(std::max(size, size_t(RealSimd::static_size))),
+	twiddle_imag(std::max(size, size_t(RealSimd::static_size)))
+{
+	BOOST_ASSERT_MSG(size >= 1 && (size & (size - 1)) == 0, "The size of a FFT has to be a power of two!");
+	uint32_t bits = 0;
+	while ((size_t(1) << bits) < size)
+		++bits;
+	for (uint32_t i = 0; i < size; ++i) {
+		uint32_t reversed = 0;
+		for (uint32_t b = 0; b < bits; ++b)
+			reversed |= ((i >> b) & 1) << (bits - 1 - b);
+		if (i < reversed)
+			swaps.push_back({ i, reversed });
+	}
+	for (size_t h = 1; h < size; h *= 2) {
+		for (size_t j = 0; j < h; ++j) {
+			const double angle = -boost::math::constants::pi<double>() * j / h;
+			twiddle_real[h + j] = static_cast<Real>(std::cos(angle));
+			twiddle_imag[h + j] = static_cast<Real>(std::sin(angle));
+		}
+	}
+}
+
+
+void FftPlan::Forward(Real* real, Real* imag) const
+{
+	for (const std::pair<uint32_t, uint32_t>& swap : swaps) {
+		std::swap(real[swap.first], real[swap.second]);
+		std::swap(imag[swap.first], imag[swap.second]);
+	}
+	size_t h = 1;
+	//The butterflies of the first stages are shorter than a SIMD register
+	for (; h < size && h < RealSimd::static_size; h *= 2) {
+		for (size_t group = 0; group < size; group += 2 * h) {
+			for (size_t j = 0; j < h; ++j) {
+				const size_t a = group + j;
+				const size_t b = a + h;
+				const Real t_real = real[b] * twiddle_real[h + j] - imag[b] * twiddle_imag[h + j];
+				const Real t_imag = real[b] * twiddle_imag[h + j] + imag[b] * twiddle_real[h + j];
+				real[b] = real[a] - t_real;
+				imag[b] = imag[a] - t_imag;
+				real[a] += t_real;
+				imag[a] += t_imag;
+			}
+		}
+	}
+	for (; h < size; h *= 2) {
+		for (size_t group = 0; group < size; group += 2 * h) {
+			for (size_t j = 0; j < h; j += RealSimd::static_size) {
+				const RealSimd w_real = boost::simd::aligned_load<RealSimd>(twiddle_real.data() + h + j);
+				const RealSimd w_imag = boost::simd::aligned_load<RealSimd>(twiddle_imag.data() + h + j);
+				Real* a_real = real + group + j;
+				Real* a_imag = imag + group + j;
+				Real* b_real = a_real + h;
+				Real* b_imag = a_imag + h;
+				const RealSimd x_real = boost::simd::aligned_load<RealSimd>(a_real);
+				const RealSimd x_imag = boost::simd::aligned_load<RealSimd>(a_imag);
+				const RealSimd y_real = boost::simd::aligned_load<RealSimd>(b_real);
+				const RealSimd y_imag = boost::simd::aligned_load<RealSimd>(b_imag);
+				const RealSimd t_real = y_real * w_real - y_imag * w_imag;
+				const RealSimd t_imag = y_real * w_imag + y_imag * w_real;
+				boost::simd::aligned_store(x_real + t_real, a_real);
+				boost::simd::aligned_store(x_imag + t_imag, a_imag);
+				boost::simd::aligned_store(x_real - t_real, b_real);
+				boost::simd::aligned_store(x_imag - t_imag, b_imag);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <filter/fir_design.h>
+#include <unsupported/Eigen/FFT>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/sinc.hpp>
+#include <algorithm>
+#include <cmath>
+
+
+
+std::vector<Real> MinimumPhase(const std::vector<Real>& coeff)
+{
+	if (coeff.size() < 2)
+		return coeff;
+
+	//Zero pad generously to keep the aliasing of the cepstrum small
+	size_t nfft = 1024;
+	while (nfft < 16 * coeff.size())
+		nfft *= 2;
+	Eigen::FFT<Real> fft;
+
+	//Calculate the logarithm of the magnitude response
+	std::vector<Complex> time(nfft, Complex(0));
+	std::vector<Complex> freq(nfft);
+	std::copy(coeff.cbegin(), coeff.cend(), time.begin());
+	fft.fwd(freq, time);
+	Real max_magnitude = 0;
+	for (const Complex& c : freq)
+		max_magnitude = std::max(max_magnitude, std::abs(c));
+	//The zeros of the stopband would make the logarithm diverge, so clamp it to -200dB
+	const Real min_magnitude = max_magnitude * Real(1e-10);
+	for (Complex& c : freq)
+		c = Complex(std::log(std::max(std::abs(c), min_magnitude)), 0);
+
+	//Fold the real cepstrum onto the positive quefrencies
+	fft.inv(time, freq);
+	for (size_t i = 1; i < nfft / 2; ++i) {
+		time[i] = Real(2) * time[i].real();
+		time[nfft - i] = 0;
+	}
+	time[0] = time[0].real();
+	time[nfft / 2] = time[nfft / 2].real();
+
+	//Transform back to the minimum phase impulse response
+	fft.fwd(freq, time);
+	for (Complex& c : freq)
+		c = std::exp(c);
+	fft.inv(time, freq);
+
+	std::vector<Real> result(coeff.size());
+	for (size_t i = 0; i < result.size(); ++i)
+		result[i] = time[i].real();
+	return result;
+}
+
+
+Real FirGroupDelay(const std::vector<Real>& coeff)
+{
+	if (coeff.empty())
+		return 0;
+
+	//The group delay at DC is sum(n*h[n]) / sum(h[n])
+	Real sum = 0, weighted_sum = 0;
+	for (size_t i = 0; i < coeff.size(); ++i) {
+		sum += coeff[i];
+		weighted_sum += i * coeff[i];
+	}
+	Real magnitude = 0;
+	for (Real c : coeff)
+		magnitude += std::abs(c);
+	if (std::abs(sum) > Real(1e-6) * magnitude)
+		return weighted_sum / sum;
+
+	//The filter blocks DC, use the nyquist frequency instead where h[n] is weighted with (-1)^n
+	sum = 0;
+	weighted_sum = 0;
+	for (size_t i = 0; i < coeff.size(); ++i) {
+		const Real sign = i % 2 == 0 ? Real(1) : Real(-1);
+		sum += sign * coeff[i];
+		weighted_sum += sign * i * coeff[i];
+	}
+	if (std::abs(sum) > Real(1e-6) * magnitude)
+		return weighted_sum / sum;
+	return Real(coeff.size() - 1) / 2;
+}
+
+
+
+std::vector<Real> LowPassCoefficients(double sample_rate, Real cutoff_frequency, uint32_t tapcount, const std::function<Real(Real)>& window_function, FirPhase phase)
+{
+	const Real cutoff_frequency_norm = static_cast<Real>(cutoff_frequency / sample_rate);
+	std::vector<Real> coeff(tapcount);
+	for (uint32_t i = 0; i < tapcount; ++i) {
+		const Real x = i - Real(tapcount - 1) / 2;
+		coeff[i] = window_function(Real(i) / (tapcount - 1)) * 2 * cutoff_frequency_norm * boost::math::sinc_pi(boost::math::constants::two_pi<Real>() * cutoff_frequency_norm * x);
+	}
+	return phase == MINIMUM_PHASE ? MinimumPhase(coeff) : coeff;
+}
@@ -10,6 +10,7 @@ template<>
 FirNoSimdImpl<Real>::FirNoSimdImpl(double sample_rate, const std::vector<Real>& coeff) :
 	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL)),
 	coefficients(coeff.crbegin(), coeff.crend()),
+	group_delay(FirGroupDelay(coeff)),
 	buffer_real(coeff.size(), Real(0))
 {
 	AddInput({ nullptr, 0 });
@@ -20,6 +21,7 @@ template<>
 FirNoSimdImpl<Complex>::FirNoSimdImpl(double sample_rate, const std::vector<Real>& coeff) :
 	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
 	coefficients(coeff.crbegin(), coeff.crend()),
+	group_delay(FirGroupDelay(coeff)),
 	buffer_real(coeff.size(), Real(0)),
 	buffer_imag(coeff.size(), Real(0))
 {
@@ -73,6 +75,7 @@ void FirNoSimdImpl<Real>::SetCoefficients(const std::vector<Real>& coeff)
 	coefficients.reserve(coeff.size());
 	for (auto it = coeff.crbegin(); it != coeff.crend(); ++it)
 		coefficients.push_back(*it);
+	group_delay = FirGroupDelay(coeff);
 	//Update the input buffer
 	buffer_real = boost::circular_buffer<Real>(coeff.size(), Real(0));
 }
@@ -86,6 +89,7 @@ void FirNoSimdImpl<Complex>::SetCoefficients(const std::vector<Real>& coeff)
 	coefficients.reserve(coeff.size());
 	for (auto it = coeff.crbegin(); it != coeff.crend(); ++it)
 		coefficients.push_back(*it);
+	group_delay = FirGroupDelay(coeff);
 	//Update the input buffer
 	buffer_real = boost::circular_buffer<Real>(coeff.size(), Real(0));
 	buffer_imag = boost::circular_buffer<Real>(coeff.size(), Real(0));
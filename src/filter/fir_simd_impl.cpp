@@ -55,4 +55,5 @@ void FirSimdImpl<Tin>::SetCoefficients(const std::vector<Real>& coeff)
 	}
 	//Update the deltaoffset variable
 	deltaoffset = arraylength - (uint32_t)coeff.size();
+	group_delay = FirGroupDelay(coeff);
 }
\ No newline at end of file
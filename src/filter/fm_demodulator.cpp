@@ -0,0 +1,43 @@
+#include <filter/fm_demodulator.h>
+#include <filter/fast_math.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/simd/function/slide.hpp>
+#include <boost/math/constants/constants.hpp>
+
+
+//Force the compiler to generate the Complex version of FmDemodulator
+template class FmDemodulator<Complex>;
+
+
+
+template<typename Tin>
+FmDemodulator<Tin>::FmDemodulator(double sample_rate, Real frequency, Real bandwidth) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL)),
+	frequency(frequency),
+	bandwidth(bandwidth),
+	scale(static_cast<Real>(sample_rate / (boost::math::constants::pi<double>() * bandwidth))),
+	offset(2 * frequency / bandwidth),
+	last_real(0),
+	last_imag(0)
+{
+	AddInput({ nullptr, 0 });
+}
+
+
+template<typename Tin>
+void FmDemodulator<Tin>::Update()
+{
+	auto in = GetComplexInput(0);
+	const RealSimd re = boost::simd::aligned_load<RealSimd>(in.first);
+	const RealSimd im = boost::simd::aligned_load<RealSimd>(in.second);
+	//The previous sample of every element, the first one taken from the last block
+	const RealSimd prev_re = boost::simd::slide<RealSimd::static_size - 1>(last_real, re);
+	const RealSimd prev_im = boost::simd::slide<RealSimd::static_size - 1>(last_imag, im);
+	//conj(x[n-1]) * x[n]
+	const RealSimd diff_re = prev_re * re + prev_im * im;
+	const RealSimd diff_im = prev_re * im - prev_im * re;
+	boost::simd::aligned_store(FastAtan2(diff_im, diff_re) * RealSimd(scale) - RealSimd(offset), real());
+	last_real = re;
+	last_imag = im;
+}
\ No newline at end of file
@@ -1,7 +1,6 @@
 #include <filter/frequency_generator.h>
 #include <iostream>
 #include <utility>
-#include <boost/math/constants/constants.hpp>
 
 
 //Force the compiler to generate a Real and a Complex version of FrequencyGenerator
@@ -11,13 +10,13 @@ template class FrequencyGenerator<Complex>;
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-FrequencyGenerator<Real>::FrequencyGenerator(double sample_rate, Real frequency, Real amplitude, Real phaseshift) :
+FrequencyGenerator<Real>::FrequencyGenerator(double sample_rate, Real frequency, Real amplitude, Real phaseshift, NcoMode mode) :
 	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL)),
 	frequency(frequency),
 	amplitude(amplitude),
-	phaseshift(phaseshift)
+	phaseshift(phaseshift),
+	nco(frequency / sample_rate, phaseshift, mode)
 {
-	InitPhase();
 	CalculateOutput();
 }
 ///\endcond
@@ -25,13 +24,13 @@ FrequencyGenerator<Real>::FrequencyGenerator(double sample_rate, Real frequency,
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-FrequencyGenerator<Complex>::FrequencyGenerator(double sample_rate, Real frequency, Real amplitude, Real phaseshift) :
+FrequencyGenerator<Complex>::FrequencyGenerator(double sample_rate, Real frequency, Real amplitude, Real phaseshift, NcoMode mode) :
 	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
 	frequency(frequency),
 	amplitude(amplitude),
-	phaseshift(phaseshift)
+	phaseshift(phaseshift),
+	nco(frequency / sample_rate, phaseshift, mode)
 {
-	InitPhase();
 	CalculateOutput();
 }
 ///\endcond
@@ -42,13 +41,4 @@ void FrequencyGenerator<Tout>::Update()
 {
 	CalculateOutput();
 	UpdatePhase();
-}
-
-
-template<typename Tout>
-void FrequencyGenerator<Tout>::InitPhase()
-{
-	Real phaseshift_time = phaseshift / boost::math::constants::pi<Real>();
-	for (int i = 0; i < RealSimd::static_size; ++i)
-		phase_div_pi[i] = frequency * static_cast<Real>(2 * i * DeltatimeOut()) + phaseshift_time;
 }
\ No newline at end of file
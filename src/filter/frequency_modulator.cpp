@@ -8,15 +8,14 @@ template class FrequencyModulator<Complex>;
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-FrequencyModulator<Real>::FrequencyModulator(double sample_rate, Real frequency, Real bandwidth, Real amplitude) :
+FrequencyModulator<Real>::FrequencyModulator(double sample_rate, Real frequency, Real bandwidth, Real amplitude, NcoMode mode) :
 	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL)),
 	frequency(frequency),
 	bandwidth(bandwidth),
 	amplitude(amplitude),
-	phase_div_pi(0)
+	nco(0, 0, mode == NCO_ROTATOR ? NCO_TABLE : mode)
 {
 	AddInput({ nullptr, 0 });
-	InitPhase();
 	CalculateOutput();
 }
 ///\endcond
@@ -24,15 +23,14 @@ FrequencyModulator<Real>::FrequencyModulator(double sample_rate, Real frequency,
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-FrequencyModulator<Complex>::FrequencyModulator(double sample_rate, Real frequency, Real bandwidth, Real amplitude) :
+FrequencyModulator<Complex>::FrequencyModulator(double sample_rate, Real frequency, Real bandwidth, Real amplitude, NcoMode mode) :
 	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
 	frequency(frequency),
 	bandwidth(bandwidth),
 	amplitude(amplitude),
-	phase_div_pi(0)
+	nco(0, 0, mode == NCO_ROTATOR ? NCO_TABLE : mode)
 {
 	AddInput({ nullptr, 0 });
-	InitPhase();
 	CalculateOutput();
 }
 ///\endcond
@@ -43,12 +41,4 @@ void FrequencyModulator<Tout>::Update()
 {
 	UpdatePhase();
 	CalculateOutput();
-}
-
-
-template<typename Tout>
-void FrequencyModulator<Tout>::InitPhase()
-{
-	for (int i = 0; i < RealSimd::static_size; ++i)
-		phase_div_pi[i] = frequency * static_cast<Real>(2 * i * DeltatimeOut());
 }
\ No newline at end of file
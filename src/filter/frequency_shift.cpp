@@ -8,12 +8,11 @@ template class FrequencyShift<Complex>;
 
 
 template<typename Tin>
-FrequencyShift<Tin>::FrequencyShift(double sample_rate, Real shift) :
+FrequencyShift<Tin>::FrequencyShift(double sample_rate, Real shift, NcoMode mode) :
 	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
-	deltaphase_div_pi(2 * shift / sample_rate)
+	nco(shift / sample_rate, 0, mode)
 {
 	AddInput({ nullptr, 0 });
-	initPhase();
 }
 
 
@@ -22,12 +21,4 @@ void FrequencyShift<Tin>::Update()
 {
 	CalculateOutput();
 	UpdatePhase();
-}
-
-
-template<typename Tin>
-void FrequencyShift<Tin>::initPhase()
-{
-	for (int i = 0; i < RealSimd::static_size; ++i)
-		phase_div_pi[i] = i * deltaphase_div_pi;
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <filter/goertzel_bank.h>
+#include <utils.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cmath>
+
+
+//Force the compiler to generate a Real and a Complex version of GoertzelBank
+template class GoertzelBank<Real>;
+template class GoertzelBank<Complex>;
+
+
+
+template<typename Tin>
+GoertzelBank<Tin>::GoertzelBank(double sample_rate, const std::vector<Real>& frequencies, uint32_t block_length) :
+	Filter(sample_rate, block_length),
+	frequencies(frequencies),
+	block_length(block_length),
+	coefficients(ceilto<size_t>(RealSimd::static_size, frequencies.size()), Real(0)),
+	cosines(coefficients.size(), Real(0)),
+	sines(coefficients.size(), Real(0)),
+	state_real(2 * coefficients.size(), Real(0)),
+	state_imag(2 * coefficients.size(), Real(0)),
+	powers(coefficients.size(), Real(0))
+{
+	BOOST_ASSERT_MSG(block_length > 0 && block_length % RealSimd::static_size == 0, "The block length has to be a multiple of the SIMD block size!");
+	AddInput({ nullptr, 0 });
+	for (size_t i = 0; i < frequencies.size(); ++i) {
+		const double omega = boost::math::constants::two_pi<double>() * frequencies[i] / sample_rate;
+		coefficients[i] = static_cast<Real>(2 * std::cos(omega));
+		cosines[i] = static_cast<Real>(std::cos(omega));
+		sines[i] = static_cast<Real>(std::sin(omega));
+	}
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void GoertzelBank<Real>::Update()
+{
+	Recurse(GetRealInput(0), state_real.data());
+	sample_count += RealSimd::static_size;
+	powers_ready = sample_count == block_length;
+	if (powers_ready)
+		Finish();
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void GoertzelBank<Complex>::Update()
+{
+	auto in = GetComplexInput(0);
+	Recurse(in.first, state_real.data());
+	Recurse(in.second, state_imag.data());
+	sample_count += RealSimd::static_size;
+	powers_ready = sample_count == block_length;
+	if (powers_ready)
+		Finish();
+}
+///\endcond
+
+
+template<typename Tin>
+void GoertzelBank<Tin>::Recurse(const Real* in, Real* state) const
+{
+	//s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2], for a whole register of frequencies at once
+	for (size_t i = 0; i < coefficients.size(); i += RealSimd::static_size) {
+		const RealSimd coeff = boost::simd::aligned_load<RealSimd>(coefficients.data() + i);
+		RealSimd s1 = boost::simd::aligned_load<RealSimd>(state + 2 * i);
+		RealSimd s2 = boost::simd::aligned_load<RealSimd>(state + 2 * i + RealSimd::static_size);
+		for (size_t n = 0; n < RealSimd::static_size; ++n) {
+			const RealSimd s0 = RealSimd(in[n]) + coeff * s1 - s2;
+			s2 = s1;
+			s1 = s0;
+		}
+		boost::simd::aligned_store(s1, state + 2 * i);
+		boost::simd::aligned_store(s2, state + 2 * i + RealSimd::static_size);
+	}
+}
+
+
+template<typename Tin>
+void GoertzelBank<Tin>::Finish()
+{
+	//X = exp(i*w)*s[N-1] - s[N-2], where s is complex for a complex input
+	const RealSimd norm(Real(1) / (Real(block_length) * block_length));
+	for (size_t i = 0; i < coefficients.size(); i += RealSimd::static_size) {
+		const RealSimd c = boost::simd::aligned_load<RealSimd>(cosines.data() + i);
+		const RealSimd s = boost::simd::aligned_load<RealSimd>(sines.data() + i);
+		const RealSimd s1_real = boost::simd::aligned_load<RealSimd>(state_real.data() + 2 * i);
+		const RealSimd s2_real = boost::simd::aligned_load<RealSimd>(state_real.data() + 2 * i + RealSimd::static_size);
+		const RealSimd s1_imag = boost::simd::aligned_load<RealSimd>(state_imag.data() + 2 * i);
+		const RealSimd s2_imag = boost::simd::aligned_load<RealSimd>(state_imag.data() + 2 * i + RealSimd::static_size);
+		const RealSimd x_real = c * s1_real - s * s1_imag - s2_real;
+		const RealSimd x_imag = s * s1_real + c * s1_imag - s2_imag;
+		boost::simd::aligned_store((x_real * x_real + x_imag * x_imag) * norm, powers.data() + i);
+	}
+	std::fill(state_real.begin(), state_real.end(), Real(0));
+	std::fill(state_imag.begin(), state_imag.end(), Real(0));
+	sample_count = 0;
+}
@@ -0,0 +1,96 @@
+#include <filter/nco.h>
+#include <boost/math/constants/constants.hpp>
+#include <boost/assert.hpp>
+#include <cmath>
+
+
+
+///\cond IMPLEMENTATION_DETAILS
+namespace
+{
+	/**
+	 * \brief Get the sine table shared by all oscillators.
+	 *
+	 * The table stores one period of the sine with `2^NCO_TABLE_BITS` entries plus one
+	 * guard entry, such that the interpolation never has to wrap around.
+	 */
+	const std::vector<Real>& SineTable()
+	{
+		static const std::vector<Real> table = []() {
+			std::vector<Real> t((1 << NCO_TABLE_BITS) + 1);
+			for (int i = 0; i < (int)t.size(); ++i)
+				t[i] = static_cast<Real>(std::sin(boost::math::constants::two_pi<double>() * i / (1 << NCO_TABLE_BITS)));
+			return t;
+		}();
+		return table;
+	}
+}
+///\endcond
+
+
+Nco::Nco(double cycles_per_sample, Real phaseshift, NcoMode mode) :
+	mode(mode),
+	increment(CyclesToPhase(cycles_per_sample))
+{
+	const uint64_t start = CyclesToPhase(phaseshift / boost::math::constants::two_pi<double>());
+	for (size_t i = 0; i < RealSimd::static_size; ++i)
+		phase[i] = start + i * increment;
+	next_phase = start + RealSimd::static_size * increment;
+	if (mode == NCO_ROTATOR) {
+		const double step = boost::math::constants::two_pi<double>() * (increment * RealSimd::static_size) / 18446744073709551616.0;
+		step_real = static_cast<Real>(std::cos(step));
+		step_imag = static_cast<Real>(std::sin(step));
+		RenormalizeRotator();
+	}
+}
+
+
+void Nco::Advance(const RealSimd& cycles_per_sample)
+{
+	BOOST_ASSERT_MSG(mode != NCO_ROTATOR, "A rotating phasor can not follow a varying frequency!");
+	const RealSimd inclusive = PrefixSum(cycles_per_sample);
+	//The phase of every sample relative to the first one, wrapped into [-0.5, 0.5] periods without any branches
+	RealSimd exclusive = inclusive - cycles_per_sample;
+	exclusive -= boost::simd::round(exclusive);
+	alignas(RealSimd::alignment) Real offsets[RealSimd::static_size];
+	boost::simd::aligned_store(exclusive, offsets);
+	//Converting to 2^63 per period can not overflow a signed integer, integer arithmetic then wraps the phase around
+	for (size_t i = 0; i < RealSimd::static_size; ++i)
+		phase[i] = next_phase + 2 * static_cast<uint64_t>(static_cast<int64_t>(offsets[i] * Real(9223372036854775808.0)));
+	next_phase += CyclesToPhase(inclusive[RealSimd::static_size - 1]);
+}
+
+
+uint64_t Nco::CyclesToPhase(double cycles)
+{
+	//Only the fractional part of the phase is relevant, which is in the interval [0, 1)
+	const double fraction = cycles - std::floor(cycles);
+	return fraction < 1 ? static_cast<uint64_t>(std::ldexp(fraction, 64)) : 0;
+}
+
+
+RealSimd Nco::TableLookup(const PhaseArray& phases, uint64_t offset)
+{
+	constexpr int fraction_bits = 32;
+	constexpr Real fraction_scale = Real(1) / Real(uint64_t(1) << fraction_bits);
+	const std::vector<Real>& table = SineTable();
+	alignas(RealSimd::alignment) Real result[RealSimd::static_size];
+	for (size_t i = 0; i < RealSimd::static_size; ++i) {
+		const uint64_t p = phases[i] + offset;
+		//The upper bits select the table entry, the following ones are used for interpolation
+		const uint64_t index = p >> (64 - NCO_TABLE_BITS);
+		const Real fraction = static_cast<Real>((p >> (64 - NCO_TABLE_BITS - fraction_bits)) & 0xFFFFFFFF) * fraction_scale;
+		result[i] = table[index] + fraction * (table[index + 1] - table[index]);
+	}
+	return boost::simd::aligned_load<RealSimd>(result);
+}
+
+
+void Nco::RenormalizeRotator()
+{
+	//Recalculating the phasor from the integer phase removes any accumulated magnitude and phase error
+	auto exact = boost::simd::sincospi(PhaseDivPi());
+	rotator_real = exact.second;
+	rotator_imag = exact.first;
+	steps_since_renormalization = 0;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <filter/raw_iq_input.h>
+#include <algorithm>
+#include <limits>
+
+
+//Force the compiler to generate the Complex version of RawIqInput
+template class RawIqInput<Complex>;
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Pick the conversion matching the samples in the file once, so Update doesn't have to
+inline DeinterleaveFunction ChooseRawIqDeinterleave(RawIqFormat format)
+{
+	switch (format) {
+	case RAW_IQ_CU8:  return DeinterleaveSamples<uint8_t>;
+	case RAW_IQ_CS8:  return DeinterleaveSamples<int8_t>;
+	case RAW_IQ_CS16: return DeinterleaveSamples<int16_t>;
+	case RAW_IQ_CF32: return DeinterleaveSamples<float>;
+	}
+	BOOST_ASSERT_MSG(false, "Unknown raw IQ format!");
+	return nullptr;
+}
+///\endcond
+
+
+template<typename Tout>
+RawIqInput<Tout>::RawIqInput(double sample_rate, const std::string& path, RawIqFormat format, FileReadMode mode) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
+	file(path, 0, std::numeric_limits<uint64_t>::max(), mode),
+	format(format),
+	frame_size(2 * RawIqSampleSize(format)),
+	deinterleave(ChooseRawIqDeinterleave(format)),
+	scale(Real(1) / RawIqFullScale(format))
+{
+}
+
+
+template<typename Tout>
+RawIqInput<Tout>::RawIqInput(double sample_rate, int descriptor, RawIqFormat format, FileReadMode mode) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
+	file(descriptor, mode),
+	format(format),
+	frame_size(2 * RawIqSampleSize(format)),
+	deinterleave(ChooseRawIqDeinterleave(format)),
+	scale(Real(1) / RawIqFullScale(format))
+{
+}
+
+
+template<typename Tout>
+void RawIqInput<Tout>::Update()
+{
+	size_t size = RealSimd::static_size * frame_size;
+	const uint8_t* bytes = file.Read(size);
+	//A partial sample at the end of the file is dropped
+	const size_t count = size / frame_size;
+	Real* const channels[] = { real(0), imag(0) };
+	deinterleave(bytes, count, 2, scale, channels);
+	if (count < RealSimd::static_size) {
+		end_of_file = true;
+		for (Real* channel : channels)
+			std::fill(channel + count, channel + RealSimd::static_size, Real(0));
+	}
+}
@@ -0,0 +1,56 @@
+#include <filter/raw_iq_output.h>
+
+
+//Force the compiler to generate the Complex version of RawIqOutput
+template class RawIqOutput<Complex>;
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Pick the conversion matching the samples in the file once, so Update doesn't have to
+inline InterleaveFunction ChooseRawIqInterleave(RawIqFormat format)
+{
+	switch (format) {
+	case RAW_IQ_CU8:  return InterleaveSamples<uint8_t>;
+	case RAW_IQ_CS8:  return InterleaveSamples<int8_t>;
+	case RAW_IQ_CS16: return InterleaveSamples<int16_t>;
+	case RAW_IQ_CF32: return InterleaveSamples<float>;
+	}
+	BOOST_ASSERT_MSG(false, "Unknown raw IQ format!");
+	return nullptr;
+}
+///\endcond
+
+
+template<typename Tin>
+RawIqOutput<Tin>::RawIqOutput(double sample_rate, const std::string& path, RawIqFormat format, Real dampening_factor, FileWriteMode mode) :
+	Filter(sample_rate),
+	file(path, mode),
+	format(format),
+	frame_size(2 * RawIqSampleSize(format)),
+	interleave(ChooseRawIqInterleave(format)),
+	scale(RawIqFullScale(format) * dampening_factor)
+{
+	AddInput({ nullptr, 0 });
+}
+
+
+template<typename Tin>
+RawIqOutput<Tin>::RawIqOutput(double sample_rate, int descriptor, RawIqFormat format, Real dampening_factor, FileWriteMode mode) :
+	Filter(sample_rate),
+	file(descriptor, mode),
+	format(format),
+	frame_size(2 * RawIqSampleSize(format)),
+	interleave(ChooseRawIqInterleave(format)),
+	scale(RawIqFullScale(format) * dampening_factor)
+{
+	AddInput({ nullptr, 0 });
+}
+
+
+template<typename Tin>
+void RawIqOutput<Tin>::Update()
+{
+	auto in = GetComplexInput(0);
+	const Real* const channels[] = { in.first, in.second };
+	interleave(channels, RealSimd::static_size, 2, scale, file.Append(RealSimd::static_size * frame_size));
+}
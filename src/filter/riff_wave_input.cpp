@@ -1,5 +1,6 @@
 #include <filter/riff_wave_input.h>
-#include <vector>
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 
 
@@ -8,49 +9,92 @@ template class RiffWaveInput<Real>;
 template class RiffWaveInput<Complex>;
 
 
+///\cond IMPLEMENTATION_DETAILS
+//Pick the conversion matching the samples in the file once, so Update doesn't have to
+inline DeinterleaveFunction ChooseDeinterleave(uint16_t format, uint16_t bits)
+{
+	if (format == RIFF_WAVE_PCM) {
+		switch (bits) {
+		case 8:  return DeinterleaveSamples<uint8_t>;
+		case 16: return DeinterleaveSamples<int16_t>;
+		case 24: return DeinterleaveSamples<Pcm24>;
+		case 32: return DeinterleaveSamples<int32_t>;
+		}
+	}
+	else if (format == RIFF_WAVE_IEEE_FLOAT) {
+		switch (bits) {
+		case 32: return DeinterleaveSamples<float>;
+		case 64: return DeinterleaveSamples<double>;
+		}
+	}
+	//Asserts are compiled away in release builds, but Update would then call a null pointer
+	throw std::invalid_argument("The samples have to be integers with 8, 16, 24 or 32 bits or floating point numbers with 32 or 64 bits!");
+}
+
+inline Real SampleScale(uint16_t format, uint32_t max_sample_value)
+{
+	return format == RIFF_WAVE_IEEE_FLOAT ? Real(1) : Real(1) / max_sample_value;
+}
+///\endcond
+
+
+template<typename Tout>
+RiffWaveInput<Tout>::RiffWaveInput(const std::string& path, FileReadMode mode) :
+	RIFFWaveIStream(path, mode),
+	Filter(FrameRate()),
+	deinterleave(ChooseDeinterleave(SampleFormat(), BitsPerSample())),
+	scale(SampleScale(SampleFormat(), MaxSampleValue()))
+{
+	AddChannels();
+}
+
+
+template<typename Tout>
+RiffWaveInput<Tout>::RiffWaveInput(int descriptor, FileReadMode mode) :
+	RIFFWaveIStream(descriptor, mode),
+	Filter(FrameRate()),
+	deinterleave(ChooseDeinterleave(SampleFormat(), BitsPerSample())),
+	scale(SampleScale(SampleFormat(), MaxSampleValue()))
+{
+	AddChannels();
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
 template<>
-RiffWaveInput<Real>::RiffWaveInput(const std::string& path) :
-	RIFFWaveIStream(path),
-	Filter(FrameRate())
+void RiffWaveInput<Real>::AddChannels()
 {
 	for (int i = 0; i < ChannelCount(); ++i)
 		AddOutput(Filter::FilterOutputType::REAL);
+	for (int i = 0; i < ChannelCount(); ++i)
+		channels.push_back(real(i));
 }
+///\endcond
 
 
+///\cond IMPLEMENTATION_DETAILS
 template<>
-RiffWaveInput<Complex>::RiffWaveInput(const std::string& path) :
-	RIFFWaveIStream(path),
-	Filter(FrameRate())
+void RiffWaveInput<Complex>::AddChannels()
 {
 	BOOST_ASSERT_MSG(ChannelCount() % 2 == 0, "In order to provide complex output, the number of audio channels has to be even!");
 	for (int i = 0; i < ChannelCount() / 2; ++i)
 		AddOutput(Filter::FilterOutputType::COMPLEX);
-}
-
-
-template<>
-void RiffWaveInput<Real>::Update()
-{
-	int16_t sample[1];
-	for (int channel = 0; channel < ChannelCount(); ++channel) {
-		for (int i = 0; i < RealSimd::static_size; ++i) {
-			this->operator>>(sample);
-			real(channel)[i] = static_cast<Real>(sample[0]) / MaxSampleValue();
-		}
+	//I/Q pairs are split into the real and imaginary part of an output
+	for (int i = 0; i < ChannelCount() / 2; ++i) {
+		channels.push_back(real(i));
+		channels.push_back(imag(i));
 	}
 }
+///\endcond
 
 
-template<>
-void RiffWaveInput<Complex>::Update()
+template<typename Tout>
+void RiffWaveInput<Tout>::Update()
 {
-	int16_t sample[2];
-	for (int channel = 0; channel < ChannelCount(); ++channel) {
-		for (int i = 0; i < RealSimd::static_size; ++i) {
-			this->operator >> (sample);
-			real(channel)[i] = static_cast<Real>(sample[0]) / MaxSampleValue();
-			imag(channel)[i] = static_cast<Real>(sample[1]) / MaxSampleValue();
-		}
-	}
-}
\ No newline at end of file
+	uint32_t count = RealSimd::static_size;
+	const uint8_t* bytes = readFrames(count);
+	deinterleave(bytes, count, ChannelCount(), scale, channels.data());
+	if (count < RealSimd::static_size)
+		for (Real* channel : channels)
+			std::fill(channel + count, channel + RealSimd::static_size, Real(0));
+}
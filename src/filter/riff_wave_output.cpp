@@ -1,5 +1,6 @@
 #include <filter/riff_wave_output.h>
-#include <vector>
+#include <io/sample_conversion.h>
+#include <type_traits>
 
 
 //Force the compiler to generate a Real and a Complex version of RiffWaveOutput
@@ -9,8 +10,8 @@ template class RiffWaveOutput<Complex>;
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-RiffWaveOutput<Real>::RiffWaveOutput(uint32_t sample_rate, const std::string& path, Real dampening_factor) :
-	RIFFWaveOStream(path, sample_rate, 1),
+RiffWaveOutput<Real>::RiffWaveOutput(uint32_t sample_rate, const std::string& path, Real dampening_factor, FileWriteMode mode) :
+	RIFFWaveOStream(path, sample_rate, 1, mode),
 	Filter(sample_rate),
 	dampening_factor(dampening_factor)
 {
@@ -21,8 +22,8 @@ RiffWaveOutput<Real>::RiffWaveOutput(uint32_t sample_rate, const std::string& pa
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-RiffWaveOutput<Complex>::RiffWaveOutput(uint32_t sample_rate, const std::string& path, Real dampening_factor) :
-	RIFFWaveOStream(path, sample_rate, 2),
+RiffWaveOutput<Complex>::RiffWaveOutput(uint32_t sample_rate, const std::string& path, Real dampening_factor, FileWriteMode mode) :
+	RIFFWaveOStream(path, sample_rate, 2, mode),
 	Filter(sample_rate),
 	dampening_factor(dampening_factor)
 {
@@ -31,15 +32,22 @@ RiffWaveOutput<Complex>::RiffWaveOutput(uint32_t sample_rate, const std::string&
 ///\endcond
 
 
+template<typename Tin>
+RiffWaveOutput<Tin>::RiffWaveOutput(uint32_t sample_rate, int descriptor, Real dampening_factor, FileWriteMode mode) :
+	RIFFWaveOStream(descriptor, sample_rate, std::is_same<Tin, Complex>::value ? 2 : 1, mode),
+	Filter(sample_rate),
+	dampening_factor(dampening_factor)
+{
+	AddInput({ nullptr, 0 });
+}
+
+
 ///\cond IMPLEMENTATION_DETAILS
 template<>
 void RiffWaveOutput<Real>::Update()
 {
-	int16_t samples[1];
-	for (int sample = 0; sample < RealSimd::static_size; ++sample) {
-		samples[0] = static_cast<int16_t>(MaxSampleValue() * GetRealInput(0)[sample] * dampening_factor);
-		this->operator<<(samples);
-	}
+	const Real* channels[] = { GetRealInput(0) };
+	Write(channels);
 }
 ///\endcond
 
@@ -48,12 +56,20 @@ void RiffWaveOutput<Real>::Update()
 template<>
 void RiffWaveOutput<Complex>::Update()
 {
-	int16_t samples[2];
-	for (int sample = 0; sample < RealSimd::static_size; ++sample) {
-		auto in = GetComplexInput(0);
-		samples[0] = static_cast<int16_t>(MaxSampleValue() * in.first[sample] * dampening_factor);
-		samples[1] = static_cast<int16_t>(MaxSampleValue() * in.second[sample] * dampening_factor);
-		this->operator<<(samples);
-	}
+	auto in = GetComplexInput(0);
+	const Real* channels[] = { in.first, in.second };
+	Write(channels);
+}
+///\endcond
+
+
+template<typename Tin>
+void RiffWaveOutput<Tin>::Write(const Real* const* channels)
+{
+	uint8_t* bytes = appendFrames(RealSimd::static_size);
+	const Real scale = MaxSampleValue() * dampening_factor;
+	if (BitsPerSample() == 8)
+		InterleaveSamples<uint8_t>(channels, RealSimd::static_size, ChannelCount(), scale, bytes);
+	else
+		InterleaveSamples<int16_t>(channels, RealSimd::static_size, ChannelCount(), scale, bytes);
 }
-///\endcond
\ No newline at end of file
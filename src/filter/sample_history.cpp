@@ -0,0 +1,27 @@
+#include <filter/sample_history.h>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+
+
+
+SampleHistory::SampleHistory(size_t window_size) :
+	window_size(window_size),
+	//Reserving as much space as the window itself copies at most one sample per new sample
+	buffer(2 * window_size + 16 * RealSimd::static_size, Real(0))
+{
+	BOOST_ASSERT_MSG(window_size >= RealSimd::static_size, "The window has to contain at least one block of samples!");
+}
+
+
+void SampleHistory::Push(const Real* block)
+{
+	if (begin + window_size + RealSimd::static_size > buffer.size()) {
+		//Move the samples staying in the window back to the front of the buffer
+		std::memmove(buffer.data(), buffer.data() + begin + RealSimd::static_size, (window_size - RealSimd::static_size) * sizeof(Real));
+		begin = 0;
+	}
+	else
+		begin += RealSimd::static_size;
+	std::copy(block, block + RealSimd::static_size, buffer.begin() + begin + window_size - RealSimd::static_size);
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include <filter/shm_ring_input.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <algorithm>
+#include <type_traits>
+
+
+//Force the compiler to generate a Real and a Complex version of ShmRingInput
+template class ShmRingInput<Real>;
+template class ShmRingInput<Complex>;
+
+
+template<typename Tout>
+ShmRingInput<Tout>::ShmRingInput(double sample_rate, const std::string& name, size_t block_count) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, std::is_same<Tout, Complex>::value ? Filter::FilterOutputType::COMPLEX : Filter::FilterOutputType::REAL)),
+	ring(name, ShmRingBlockSize(std::is_same<Tout, Complex>::value ? 2 : 1), block_count, SHM_RING_READER)
+{
+	channels.push_back(real(0));
+	if (std::is_same<Tout, Complex>::value)
+		channels.push_back(imag(0));
+}
+
+
+template<typename Tout>
+void ShmRingInput<Tout>::Update()
+{
+	if (block == nullptr && !end_of_stream) {
+		block = ring.PopFull(block_size);
+		position = 0;
+		end_of_stream = block == nullptr;
+	}
+	if (end_of_stream) {
+		for (Real* channel : channels)
+			std::fill(channel, channel + RealSimd::static_size, Real(0));
+		return;
+	}
+	for (Real* channel : channels) {
+		boost::simd::aligned_store(boost::simd::aligned_load<RealSimd>(reinterpret_cast<const Real*>(block + position)), channel);
+		position += RealSimd::static_size * sizeof(Real);
+	}
+	if (position >= block_size) {
+		ring.PushEmpty();
+		block = nullptr;
+	}
+}
@@ -0,0 +1,79 @@
+#include <filter/shm_ring_output.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <type_traits>
+
+
+//Force the compiler to generate a Real and a Complex version of ShmRingOutput
+template class ShmRingOutput<Real>;
+template class ShmRingOutput<Complex>;
+
+
+template<typename Tin>
+ShmRingOutput<Tin>::ShmRingOutput(double sample_rate, const std::string& name, size_t block_count) :
+	Filter(sample_rate),
+	ring(name, ShmRingBlockSize(std::is_same<Tin, Complex>::value ? 2 : 1), block_count, SHM_RING_WRITER)
+{
+	AddInput({ nullptr, 0 });
+}
+
+
+template<typename Tin>
+ShmRingOutput<Tin>::~ShmRingOutput()
+{
+	Close();
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void ShmRingOutput<Real>::Update()
+{
+	const Real* channels[] = { GetRealInput(0) };
+	Write(channels);
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void ShmRingOutput<Complex>::Update()
+{
+	auto in = GetComplexInput(0);
+	const Real* channels[] = { in.first, in.second };
+	Write(channels);
+}
+///\endcond
+
+
+template<typename Tin>
+void ShmRingOutput<Tin>::Write(const Real* const* channels)
+{
+	if (block == nullptr) {
+		block = ring.PopEmpty();
+		position = 0;
+		//The other process is gone
+		if (block == nullptr)
+			return;
+	}
+	const size_t channel_count = std::is_same<Tin, Complex>::value ? 2 : 1;
+	for (size_t i = 0; i < channel_count; ++i) {
+		boost::simd::aligned_store(boost::simd::aligned_load<RealSimd>(channels[i]), reinterpret_cast<Real*>(block + position));
+		position += RealSimd::static_size * sizeof(Real);
+	}
+	if (position == ring.BlockSize()) {
+		ring.PushFull(position);
+		block = nullptr;
+	}
+}
+
+
+template<typename Tin>
+void ShmRingOutput<Tin>::Close()
+{
+	if (block != nullptr) {
+		ring.PushFull(position);
+		block = nullptr;
+	}
+	ring.Close();
+}
@@ -0,0 +1,73 @@
+#include <filter/stft.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/simd/function/load.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <type_traits>
+
+
+//Force the compiler to generate a Real and a Complex version of Stft
+template class Stft<Real>;
+template class Stft<Complex>;
+
+
+
+template<typename Tin>
+Stft<Tin>::Stft(double sample_rate, uint32_t size, uint32_t hop, const std::function<Real(Real)>& window_function) :
+	Filter(sample_rate, hop),
+	plan(FftPlan::Get(size)),
+	window(size),
+	history_real(size),
+	history_imag(std::is_same<Tin, Complex>::value ? size : RealSimd::static_size),
+	frame_real(size, Real(0)),
+	frame_imag(size, Real(0))
+{
+	BOOST_ASSERT_MSG(size >= RealSimd::static_size, "A frame has to contain at least one block of samples!");
+	BOOST_ASSERT_MSG(hop > 0 && hop % RealSimd::static_size == 0, "The hop size has to be a multiple of the block size!");
+	AddInput({ nullptr, 0 });
+	for (uint32_t i = 0; i < size; ++i)
+		window[i] = window_function(Real(i) / size);
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void Stft<Real>::Update()
+{
+	history_real.Push(GetRealInput(0));
+	frame_ready = ++block_count * RealSimd::static_size == DecimationFactor();
+	if (frame_ready) {
+		block_count = 0;
+		Window(history_real, frame_real.data());
+		std::fill(frame_imag.begin(), frame_imag.end(), Real(0));
+		plan->Forward(frame_real.data(), frame_imag.data());
+	}
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void Stft<Complex>::Update()
+{
+	auto in = GetComplexInput(0);
+	history_real.Push(in.first);
+	history_imag.Push(in.second);
+	frame_ready = ++block_count * RealSimd::static_size == DecimationFactor();
+	if (frame_ready) {
+		block_count = 0;
+		Window(history_real, frame_real.data());
+		Window(history_imag, frame_imag.data());
+		plan->Forward(frame_real.data(), frame_imag.data());
+	}
+}
+///\endcond
+
+
+template<typename Tin>
+void Stft<Tin>::Window(const SampleHistory& history, Real* out) const
+{
+	for (size_t i = 0; i < window.size(); i += RealSimd::static_size)
+		boost::simd::aligned_store(boost::simd::load<RealSimd>(history.Data() + i) * boost::simd::aligned_load<RealSimd>(window.data() + i), out + i);
+}
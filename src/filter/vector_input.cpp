@@ -1,4 +1,9 @@
 #include <filter/vector_input.h>
+#include <io/sample_conversion.h>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/simd/function/load.hpp>
+#include <algorithm>
+#include <type_traits>
 
 
 //Force the compiler to generate a Real and a Complex version of VectorInput
@@ -7,99 +12,135 @@ template class VectorInput<Complex>;
 
 
 ///\cond IMPLEMENTATION_DETAILS
-template<>
-VectorInput<Real>::VectorInput(double sample_rate) :
-	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL))
+template<typename Tout>
+inline Filter::FilterOutputType VectorInputOutputType()
+{
+	return std::is_same<Tout, Complex>::value ? Filter::FilterOutputType::COMPLEX : Filter::FilterOutputType::REAL;
+}
+
+//Copy a run of samples, which is a single SIMD register for every block not spanning the end of the data
+inline void CopyRun(const Real* samples, size_t count, Real* out)
 {
+	if (count == RealSimd::static_size)
+		boost::simd::aligned_store(boost::simd::load<RealSimd>(samples), out);
+	else
+		std::copy(samples, samples + count, out);
 }
 ///\endcond
 
 
-///\cond IMPLEMENTATION_DETAILS
-template<>
-VectorInput<Complex>::VectorInput(double sample_rate) :
-	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX))
+template<typename Tout>
+VectorInput<Tout>::VectorInput(double sample_rate) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, VectorInputOutputType<Tout>()))
 {
 }
-///\endcond
 
 
-///\cond IMPLEMENTATION_DETAILS
-template<>
-VectorInput<Real>::VectorInput(double sample_rate, std::vector<Real> out) :
-	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL)),
+template<typename Tout>
+VectorInput<Tout>::VectorInput(double sample_rate, std::vector<Tout> out, bool split) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, VectorInputOutputType<Tout>())),
 	output_samples(std::move(out))
 {
+	Split(split);
 }
-///\endcond
 
 
-///\cond IMPLEMENTATION_DETAILS
-template<>
-VectorInput<Complex>::VectorInput(double sample_rate, std::vector<Complex> out) :
-	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
+template<typename Tout>
+VectorInput<Tout>::VectorInput(double sample_rate, std::vector<Tout>&& out, bool split) :
+	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, VectorInputOutputType<Tout>())),
 	output_samples(std::move(out))
 {
+	Split(split);
+}
+
+
+template<typename Tout>
+void VectorInput<Tout>::Update()
+{
+	if (sample_count == 0) {
+		std::fill(real(), real() + RealSimd::static_size, Real(0));
+		if (std::is_same<Tout, Complex>::value)
+			std::fill(imag(), imag() + RealSimd::static_size, Real(0));
+		return;
+	}
+	size_t filled = 0;
+	while (filled < RealSimd::static_size) {
+		const size_t count = std::min(RealSimd::static_size - filled, sample_count - current_sample);
+		Copy(filled, count);
+		filled += count;
+		current_sample += count;
+		if (current_sample == sample_count)
+			current_sample = 0;
+	}
 }
-///\endcond
 
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-VectorInput<Real>::VectorInput(double sample_rate, std::vector<Real>&& out) :
-	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::REAL)),
-	output_samples(std::move(out))
+void VectorInput<Real>::Copy(size_t offset, size_t count)
 {
+	CopyRun(output_samples.data() + current_sample, count, real() + offset);
 }
 ///\endcond
 
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-VectorInput<Complex>::VectorInput(double sample_rate, std::vector<Complex>&& out) :
-	Filter(sample_rate, std::vector<Filter::FilterOutputType>(1, Filter::FilterOutputType::COMPLEX)),
-	output_samples(std::move(out))
+void VectorInput<Complex>::Copy(size_t offset, size_t count)
 {
+	if (!split_real.empty()) {
+		CopyRun(split_real.data() + current_sample, count, real() + offset);
+		CopyRun(split_imag.data() + current_sample, count, imag() + offset);
+	}
+	else {
+		Real* const channels[] = { real() + offset, imag() + offset };
+		DeinterleaveSamples<Real>(reinterpret_cast<const uint8_t*>(output_samples.data() + current_sample), count, 2, Real(1), channels);
+	}
 }
+///\endcond
 
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-void VectorInput<Real>::Update()
+void VectorInput<Real>::Split(bool)
 {
-	auto out = real();
-	for (int i = 0; i < RealSimd::static_size; ++i) {
-		out[i] = output_samples[current_sample];
-		NextSample();
-	}
+	//Real data is already stored like the output
+	sample_count = output_samples.size();
+	current_sample = sample_count == 0 ? 0 : current_sample % sample_count;
 }
 ///\endcond
 
 
 ///\cond IMPLEMENTATION_DETAILS
 template<>
-void VectorInput<Complex>::Update()
+void VectorInput<Complex>::Split(bool split)
 {
-	auto out_re = real();
-	auto out_im = imag();
-	for (int i = 0; i < RealSimd::static_size; ++i) {
-		out_re[i] = output_samples[current_sample].real();
-		out_im[i] = output_samples[current_sample].imag();
-		NextSample();
+	sample_count = output_samples.size();
+	current_sample = sample_count == 0 ? 0 : current_sample % sample_count;
+	split_real.clear();
+	split_imag.clear();
+	if (split && sample_count != 0) {
+		split_real.resize(sample_count);
+		split_imag.resize(sample_count);
+		Real* const channels[] = { split_real.data(), split_imag.data() };
+		DeinterleaveSamples<Real>(reinterpret_cast<const uint8_t*>(output_samples.data()), sample_count, 2, Real(1), channels);
+		std::vector<Complex>().swap(output_samples);
 	}
 }
 ///\endcond
 
 
 template<typename Tout>
-void VectorInput<Tout>::SetInput(std::vector<Tout> out)
+void VectorInput<Tout>::SetInput(std::vector<Tout> out, bool split)
 {
 	output_samples = std::move(out);
+	Split(split);
 }
 
 
 template<typename Tout>
-void VectorInput<Tout>::SetInput(std::vector<Tout>&& out)
+void VectorInput<Tout>::SetInput(std::vector<Tout>&& out, bool split)
 {
 	output_samples = std::move(out);
-}
\ No newline at end of file
+	Split(split);
+}
@@ -1,4 +1,8 @@
 #include <filter/vector_output.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <algorithm>
+#include <type_traits>
 
 
 //Force the compiler to generate real and complex versions of VectorOutput
@@ -7,11 +11,54 @@ template class VectorOutput<Complex>;
 
 
 template<typename Tin>
-VectorOutput<Tin>::VectorOutput(double sample_rate) :
+constexpr size_t VectorOutput<Tin>::ChunkSize;
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Allocate a chunk, with the imaginary part only for complex samples
+template<typename Tin, typename Tchunk>
+inline void AllocateChunk(Tchunk& chunk)
+{
+	chunk.real.resize(VectorOutput<Tin>::ChunkSize);
+	if (std::is_same<Tin, Complex>::value)
+		chunk.imag.resize(VectorOutput<Tin>::ChunkSize);
+}
+///\endcond
+
+
+template<typename Tin>
+VectorOutput<Tin>::VectorOutput(double sample_rate, size_t capacity, size_t limit) :
 	Filter(sample_rate),
-	output(0)
+	limit(limit)
 {
+	static_assert(ChunkSize % RealSimd::static_size == 0, "A chunk has to hold whole blocks!");
 	AddInput({ nullptr, 0 });
+	//A ring never needs more than the chunks of the limit and the one being filled
+	if (limit != 0)
+		capacity = std::min(capacity, limit + ChunkSize);
+	chunks.resize((capacity + ChunkSize - 1) / ChunkSize);
+	for (Chunk& chunk : chunks)
+		AllocateChunk<Tin>(chunk);
+}
+
+
+template<typename Tin>
+typename VectorOutput<Tin>::Chunk& VectorOutput<Tin>::NextChunk()
+{
+	const size_t index = (count - first_sample) / ChunkSize;
+	if (index < chunks.size())
+		return chunks[index];
+	//The oldest chunk is reused once the other chunks hold enough samples
+	if (limit != 0 && count - first_sample >= limit + ChunkSize) {
+		chunks.push_back(std::move(chunks.front()));
+		chunks.pop_front();
+		first_sample += ChunkSize;
+	}
+	else {
+		chunks.emplace_back();
+		AllocateChunk<Tin>(chunks.back());
+	}
+	return chunks.back();
 }
 
 
@@ -19,9 +66,10 @@ VectorOutput<Tin>::VectorOutput(double sample_rate) :
 template<>
 void VectorOutput<Real>::Update()
 {
-	auto in = GetRealInput(0);
-	for (int i = 0; i < RealSimd::static_size; ++i)
-		output.push_back(in[i]);
+	Chunk& chunk = NextChunk();
+	const size_t offset = (count - first_sample) % ChunkSize;
+	boost::simd::aligned_store(boost::simd::aligned_load<RealSimd>(GetRealInput(0)), chunk.real.data() + offset);
+	count += RealSimd::static_size;
 }
 ///\endcond
 
@@ -30,9 +78,43 @@ void VectorOutput<Real>::Update()
 template<>
 void VectorOutput<Complex>::Update()
 {
+	Chunk& chunk = NextChunk();
+	const size_t offset = (count - first_sample) % ChunkSize;
 	auto in = GetComplexInput(0);
-	for (int i = 0; i < RealSimd::static_size; ++i)
-		output.push_back(Complex(in.first[i], in.second[i]));
+	boost::simd::aligned_store(boost::simd::aligned_load<RealSimd>(in.first), chunk.real.data() + offset);
+	boost::simd::aligned_store(boost::simd::aligned_load<RealSimd>(in.second), chunk.imag.data() + offset);
+	count += RealSimd::static_size;
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void VectorOutput<Real>::AppendOutput(size_t begin, size_t end) const
+{
+	while (begin < end) {
+		const Chunk& chunk = chunks[(begin - first_sample) / ChunkSize];
+		const size_t offset = (begin - first_sample) % ChunkSize;
+		const size_t length = std::min(end - begin, ChunkSize - offset);
+		output.insert(output.end(), chunk.real.cbegin() + offset, chunk.real.cbegin() + offset + length);
+		begin += length;
+	}
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void VectorOutput<Complex>::AppendOutput(size_t begin, size_t end) const
+{
+	while (begin < end) {
+		const Chunk& chunk = chunks[(begin - first_sample) / ChunkSize];
+		const size_t offset = (begin - first_sample) % ChunkSize;
+		const size_t length = std::min(end - begin, ChunkSize - offset);
+		for (size_t i = offset; i < offset + length; ++i)
+			output.push_back(Complex(chunk.real[i], chunk.imag[i]));
+		begin += length;
+	}
 }
 ///\endcond
 
@@ -40,5 +122,47 @@ void VectorOutput<Complex>::Update()
 template<typename Tin>
 const std::vector<Tin>& VectorOutput<Tin>::GetStored() const
 {
+	const size_t begin = count - Size();
+	//Dropping samples shifts all the others, so only a growing output is extended in place
+	if (begin != output_begin) {
+		output.clear();
+		output_begin = output_end = begin;
+	}
+	output.reserve(Size());
+	AppendOutput(output_end, count);
+	output_end = count;
 	return output;
-}
\ No newline at end of file
+}
+
+
+template<typename Tin>
+void VectorOutput<Tin>::ReleaseStored() const
+{
+	std::vector<Tin>().swap(output);
+	output_begin = output_end = 0;
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void VectorOutput<Real>::CopyTo(Real* data) const
+{
+	for (size_t i = 0; i < SegmentCount(); ++i) {
+		const Segment segment = GetSegment(i);
+		data = std::copy(segment.real, segment.real + segment.size, data);
+	}
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void VectorOutput<Complex>::CopyTo(Complex* data) const
+{
+	for (size_t i = 0; i < SegmentCount(); ++i) {
+		const Segment segment = GetSegment(i);
+		for (size_t j = 0; j < segment.size; ++j)
+			*data++ = Complex(segment.real[j], segment.imag[j]);
+	}
+}
+///\endcond
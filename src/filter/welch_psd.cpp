@@ -0,0 +1,51 @@
+#include <filter/welch_psd.h>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/aligned_store.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+
+
+//Force the compiler to generate a Real and a Complex version of WelchPsd
+template class WelchPsd<Real>;
+template class WelchPsd<Complex>;
+
+
+
+template<typename Tin>
+WelchPsd<Tin>::WelchPsd(double sample_rate, uint32_t size, uint32_t hop, uint32_t average_count, const std::function<Real(Real)>& window_function) :
+	Stft<Tin>(sample_rate, size, hop, window_function),
+	average_count(average_count),
+	sum(size, Real(0)),
+	spectrum(size, Real(0))
+{
+	BOOST_ASSERT_MSG(average_count >= 1, "At least one frame has to be averaged!");
+	//Normalize by the power of the window, so white noise has the same density for every window
+	Real window_power = 0;
+	for (uint32_t i = 0; i < size; ++i)
+		window_power += window_function(Real(i) / size) * window_function(Real(i) / size);
+	scale = static_cast<Real>(1 / (average_count * window_power * sample_rate));
+}
+
+
+template<typename Tin>
+void WelchPsd<Tin>::Update()
+{
+	Stft<Tin>::Update();
+	spectrum_ready = false;
+	if (!this->FrameReady())
+		return;
+	const Real* frame_real = this->FrameReal();
+	const Real* frame_imag = this->FrameImag();
+	for (size_t i = 0; i < sum.size(); i += RealSimd::static_size) {
+		const RealSimd re = boost::simd::aligned_load<RealSimd>(frame_real + i);
+		const RealSimd im = boost::simd::aligned_load<RealSimd>(frame_imag + i);
+		boost::simd::aligned_store(boost::simd::aligned_load<RealSimd>(sum.data() + i) + re * re + im * im, sum.data() + i);
+	}
+	if (++frame_count == average_count) {
+		for (size_t i = 0; i < sum.size(); i += RealSimd::static_size)
+			boost::simd::aligned_store(boost::simd::aligned_load<RealSimd>(sum.data() + i) * RealSimd(scale), spectrum.data() + i);
+		std::fill(sum.begin(), sum.end(), Real(0));
+		frame_count = 0;
+		spectrum_ready = true;
+	}
+}
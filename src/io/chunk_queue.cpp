@@ -0,0 +1,51 @@
+#include <io/chunk_queue.h>
+
+
+
+ChunkQueue::ChunkQueue(size_t chunk_count, size_t chunk_size) :
+	buffers(chunk_count, std::vector<uint8_t>(chunk_size)),
+	empty(chunk_count),
+	full(chunk_count)
+{
+	for (std::vector<uint8_t>& buffer : buffers)
+		empty.push({ &buffer, 0 });
+}
+
+
+void ChunkQueue::Reset()
+{
+	Chunk chunk = { nullptr, 0 };
+	while (full.pop(chunk))
+		empty.push(chunk);
+}
+
+
+void ChunkQueue::Wake()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	empty_pushed.notify_all();
+	full_pushed.notify_all();
+}
+
+
+bool ChunkQueue::WaitPop(boost::lockfree::spsc_queue<Chunk>& queue, std::condition_variable& pushed, Chunk& chunk, const std::atomic<bool>& cancel)
+{
+	//Usually, the other thread is ahead and no lock is needed
+	if (queue.pop(chunk))
+		return true;
+	std::unique_lock<std::mutex> lock(mutex);
+	//A push or a wake up can only be signalled while the lock isn't held here, so none is missed between the checks and the wait
+	while (!queue.pop(chunk)) {
+		if (cancel)
+			return queue.pop(chunk);
+		pushed.wait(lock);
+	}
+	return true;
+}
+
+
+void ChunkQueue::Notify(std::condition_variable& pushed)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	pushed.notify_one();
+}
@@ -0,0 +1,88 @@
+#include <io/descriptor.h>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+
+void PrepareDescriptor(int descriptor, size_t size)
+{
+#ifdef _WIN32
+	_setmode(descriptor, _O_BINARY);
+	(void)size;
+#elif defined(F_SETPIPE_SZ)
+	//Fails for anything but a pipe, or beyond the limit of /proc/sys/fs/pipe-max-size. The default size works as well.
+	if (fcntl(descriptor, F_GETPIPE_SZ) >= 0)
+		fcntl(descriptor, F_SETPIPE_SZ, static_cast<int>(std::min<size_t>(size, INT_MAX)));
+#else
+	(void)descriptor;
+	(void)size;
+#endif
+}
+
+
+size_t ReadDescriptor(int descriptor, uint8_t* data, size_t size, bool complete)
+{
+	size_t done = 0;
+	while (done < size) {
+#ifdef _WIN32
+		const int count = _read(descriptor, data + done, static_cast<unsigned int>(std::min<size_t>(size - done, INT_MAX)));
+#else
+		const ssize_t count = read(descriptor, data + done, size - done);
+		if (count < 0 && errno == EINTR)
+			continue;
+#endif
+		if (count <= 0)
+			break;
+		done += static_cast<size_t>(count);
+		if (!complete)
+			break;
+	}
+	return done;
+}
+
+
+bool WriteDescriptor(int descriptor, const uint8_t* data, size_t size)
+{
+	size_t done = 0;
+	while (done < size) {
+#ifdef _WIN32
+		const int count = _write(descriptor, data + done, static_cast<unsigned int>(std::min<size_t>(size - done, INT_MAX)));
+#else
+		const ssize_t count = write(descriptor, data + done, size - done);
+		if (count < 0 && errno == EINTR)
+			continue;
+#endif
+		if (count <= 0)
+			return false;
+		done += static_cast<size_t>(count);
+	}
+	return true;
+}
+
+
+bool OpenPipe(int descriptors[2])
+{
+#ifdef _WIN32
+	return _pipe(descriptors, 1 << 20, _O_BINARY) == 0;
+#else
+	return pipe(descriptors) == 0;
+#endif
+}
+
+
+void CloseDescriptor(int descriptor)
+{
+#ifdef _WIN32
+	_close(descriptor);
+#else
+	close(descriptor);
+#endif
+}
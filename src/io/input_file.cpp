@@ -0,0 +1,210 @@
+#include <io/input_file.h>
+#include <io/descriptor.h>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+
+constexpr size_t InputFile::BufferSize;
+constexpr size_t InputFile::BufferCount;
+
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Limit the range to the bytes actually in the file, e.g. if a recording was cut off before its headers were updated
+inline uint64_t ClampToFile(const std::string& path, uint64_t offset, uint64_t length)
+{
+	std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+	//An assert would be compiled away in release builds, and the size of a file that isn't open is garbage
+	if (!file.is_open())
+		throw std::runtime_error("Could not open the input file " + path + "!");
+	const uint64_t size = static_cast<uint64_t>(file.tellg());
+	return offset >= size ? 0 : std::min(length, size - offset);
+}
+///\endcond
+
+
+InputFile::InputFile(const std::string& path, uint64_t offset, uint64_t length, FileReadMode mode) :
+	mode(mode),
+	offset(offset),
+	length(ClampToFile(path, offset, length))
+{
+	if (mode == FILE_READ_MAPPED) {
+		//An empty range can't be mapped, but there is nothing to read anyway
+		if (this->length > 0) {
+			mapping = boost::interprocess::file_mapping(path.c_str(), boost::interprocess::read_only);
+			region = boost::interprocess::mapped_region(mapping, boost::interprocess::read_only, offset, this->length);
+			region.advise(boost::interprocess::mapped_region::advice_sequential);
+		}
+	}
+	else {
+		file.open(path, std::ios::in | std::ios::binary);
+		file.seekg(offset);
+		if (mode == FILE_READ_ASYNC) {
+			chunks.reset(new ChunkQueue(BufferCount, BufferSize));
+			StartThread();
+		}
+	}
+}
+
+
+InputFile::InputFile(int descriptor, FileReadMode mode) :
+	mode(mode == FILE_READ_MAPPED ? FILE_READ_STREAM : mode),
+	offset(0),
+	length(std::numeric_limits<uint64_t>::max()),
+	descriptor(descriptor)
+{
+	PrepareDescriptor(descriptor, BufferSize);
+	if (this->mode == FILE_READ_ASYNC) {
+		chunks.reset(new ChunkQueue(BufferCount, BufferSize));
+		StartThread();
+	}
+}
+
+
+InputFile::~InputFile()
+{
+	if (mode == FILE_READ_ASYNC)
+		StopThread();
+}
+
+
+const uint8_t* InputFile::Read(size_t& size)
+{
+	size = static_cast<size_t>(std::min<uint64_t>(size, length - position));
+	if (mode == FILE_READ_MAPPED) {
+		const uint8_t* data = static_cast<const uint8_t*>(region.get_address()) + position;
+		position += size;
+		return data;
+	}
+	if (mode == FILE_READ_ASYNC)
+		return ReadAsync(size);
+	//The buffer only grows, so reading blocks of the same size never allocates
+	if (buffer.size() < size)
+		buffer.resize(size);
+	size = ReadBytes(buffer.data(), size);
+	position += size;
+	return buffer.data();
+}
+
+
+size_t InputFile::ReadBytes(uint8_t* data, size_t size)
+{
+	if (descriptor >= 0)
+		return ReadDescriptor(descriptor, data, size);
+	file.read(reinterpret_cast<char*>(data), size);
+	return static_cast<size_t>(file.gcount());
+}
+
+
+void InputFile::Seek(uint64_t position)
+{
+	if (descriptor >= 0) {
+		BOOST_ASSERT_MSG(position >= this->position, "A file descriptor can only be read forwards!");
+		while (this->position < position) {
+			size_t size = static_cast<size_t>(std::min<uint64_t>(position - this->position, BufferSize));
+			Read(size);
+			if (size == 0)
+				break;
+		}
+		return;
+	}
+	if (mode == FILE_READ_ASYNC)
+		StopThread();
+	this->position = std::min(position, length);
+	if (mode != FILE_READ_MAPPED) {
+		file.clear();
+		file.seekg(offset + this->position);
+	}
+	if (mode == FILE_READ_ASYNC)
+		StartThread();
+}
+
+
+const uint8_t* InputFile::ReadAsync(size_t& size)
+{
+	//There might be no current buffer after a seek, even if nothing is to be read
+	if (size == 0 || (current_position == current.size && !NextChunk())) {
+		size = 0;
+		return buffer.data();
+	}
+	//Usually, the bytes are all in the current buffer
+	if (current.size - current_position >= size) {
+		const uint8_t* data = current.bytes->data() + current_position;
+		current_position += size;
+		position += size;
+		return data;
+	}
+	//Otherwise, they are copied together from the end of this one and the start of the next ones
+	if (buffer.size() < size)
+		buffer.resize(size);
+	size_t copied = 0;
+	while (copied < size) {
+		if (current_position == current.size && !NextChunk())
+			break;
+		const size_t count = std::min(size - copied, current.size - current_position);
+		memcpy(buffer.data() + copied, current.bytes->data() + current_position, count);
+		copied += count;
+		current_position += count;
+	}
+	size = copied;
+	position += size;
+	return buffer.data();
+}
+
+
+bool InputFile::NextChunk()
+{
+	if (current.bytes)
+		chunks->PushEmpty(current);
+	current = { nullptr, 0 };
+	current_position = 0;
+	//The chunks the thread pushed before finishing are still taken
+	return chunks->WaitPopFull(current, finished);
+}
+
+
+void InputFile::StartThread()
+{
+	stop = false;
+	finished = false;
+	thread = std::thread(&InputFile::ReadAhead, this, position);
+}
+
+
+void InputFile::StopThread()
+{
+	stop = true;
+	chunks->Wake();
+	if (thread.joinable())
+		thread.join();
+	if (current.bytes)
+		chunks->PushEmpty(current);
+	current = { nullptr, 0 };
+	current_position = 0;
+	chunks->Reset();
+}
+
+
+void InputFile::ReadAhead(uint64_t start)
+{
+	uint64_t remaining = length - start;
+	while (remaining > 0 && !stop) {
+		ChunkQueue::Chunk chunk = { nullptr, 0 };
+		//All buffers are full if the processing is slower than the disk
+		if (!chunks->WaitPopEmpty(chunk, stop))
+			break;
+		const size_t size = static_cast<size_t>(std::min<uint64_t>(chunk.bytes->size(), remaining));
+		//Pass on what a pipe delivered right away, instead of waiting for a whole buffer of a slow live stream
+		chunk.size = descriptor >= 0 ? ReadDescriptor(descriptor, chunk.bytes->data(), size, false) : ReadBytes(chunk.bytes->data(), size);
+		//An empty chunk is passed on as well, only the reading thread may return it to the pool
+		chunks->PushFull(chunk);
+		if (chunk.size == 0)
+			break;
+		remaining -= chunk.size;
+	}
+	finished = true;
+	chunks->Wake();
+}
@@ -0,0 +1,149 @@
+#include <io/output_file.h>
+#include <io/descriptor.h>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+
+
+constexpr size_t OutputFile::BufferSize;
+constexpr size_t OutputFile::BufferCount;
+
+
+
+OutputFile::OutputFile(const std::string& path, FileWriteMode mode) :
+	mode(mode),
+	file(path, std::ios::out | std::ios::binary),
+	seekable(true),
+	current(&buffer)
+{
+	BOOST_ASSERT_MSG(file.is_open(), "Could not open the output file!");
+	if (mode == FILE_WRITE_ASYNC) {
+		chunks.reset(new ChunkQueue(BufferCount, BufferSize));
+		ChunkQueue::Chunk chunk = { nullptr, 0 };
+		const bool popped = chunks->PopEmpty(chunk);
+		BOOST_ASSERT_MSG(popped, "A new pool has to have an empty buffer!");
+		(void)popped;
+		current = chunk.bytes;
+		StartThread();
+	}
+	else
+		buffer.resize(BufferSize);
+}
+
+
+OutputFile::OutputFile(int descriptor, FileWriteMode mode) :
+	mode(mode),
+	descriptor(descriptor),
+	seekable(false),
+	current(&buffer)
+{
+	PrepareDescriptor(descriptor, BufferSize);
+	if (mode == FILE_WRITE_ASYNC) {
+		chunks.reset(new ChunkQueue(BufferCount, BufferSize));
+		ChunkQueue::Chunk chunk = { nullptr, 0 };
+		const bool popped = chunks->PopEmpty(chunk);
+		BOOST_ASSERT_MSG(popped, "A new pool has to have an empty buffer!");
+		(void)popped;
+		current = chunk.bytes;
+		StartThread();
+	}
+	else
+		buffer.resize(BufferSize);
+}
+
+
+OutputFile::~OutputFile()
+{
+	if (IsOpen())
+		Close();
+}
+
+
+void OutputFile::Write(const void* data, size_t size)
+{
+	memcpy(Append(size), data, size);
+}
+
+
+void OutputFile::WriteAt(uint64_t position, const void* data, size_t size)
+{
+	BOOST_ASSERT_MSG(seekable, "Bytes written to a file descriptor can't be overwritten!");
+	Flush();
+	//The background thread must not write at the same time
+	if (mode == FILE_WRITE_ASYNC)
+		StopThread();
+	file.seekp(position);
+	file.write(reinterpret_cast<const char*>(data), size);
+	file.seekp(0, std::ios::end);
+	//Writing past the end extends the file
+	written = std::max<uint64_t>(written, position + size);
+	if (mode == FILE_WRITE_ASYNC)
+		StartThread();
+}
+
+
+void OutputFile::Flush()
+{
+	if (mode == FILE_WRITE_ASYNC) {
+		if (used == 0)
+			return;
+		chunks->PushFull({ current, used });
+		ChunkQueue::Chunk chunk = { nullptr, 0 };
+		//Only wait if the disk is slower than the processing. The thread is running, so the waiting isn't cancelled.
+		const bool popped = chunks->WaitPopEmpty(chunk, stop);
+		BOOST_ASSERT_MSG(popped, "The background thread stopped while a buffer was waiting!");
+		(void)popped;
+		current = chunk.bytes;
+	}
+	else
+		WriteBytes(buffer.data(), used);
+	written += used;
+	used = 0;
+}
+
+
+void OutputFile::Close()
+{
+	Flush();
+	if (mode == FILE_WRITE_ASYNC)
+		StopThread();
+	if (seekable)
+		file.close();
+	descriptor = -1;
+}
+
+
+void OutputFile::WriteBytes(const uint8_t* data, size_t size)
+{
+	if (descriptor >= 0)
+		WriteDescriptor(descriptor, data, size);
+	else
+		file.write(reinterpret_cast<const char*>(data), size);
+}
+
+
+void OutputFile::StartThread()
+{
+	stop = false;
+	thread = std::thread(&OutputFile::WriteBehind, this);
+}
+
+
+void OutputFile::StopThread()
+{
+	stop = true;
+	chunks->Wake();
+	if (thread.joinable())
+		thread.join();
+}
+
+
+void OutputFile::WriteBehind()
+{
+	//The buffers pushed before the stop signal are still written
+	ChunkQueue::Chunk chunk = { nullptr, 0 };
+	while (chunks->WaitPopFull(chunk, stop)) {
+		WriteBytes(chunk.bytes->data(), chunk.size);
+		chunks->PushEmpty(chunk);
+	}
+}
@@ -1,80 +1,113 @@
 #include <io/riff_wave.h>
-#include <boost/endian/arithmetic.hpp>
-
-
-//---------- RIFFWaveStream::FMTHeader Implementation ----------//
-
-void RIFFWaveStream::FMTHeader::load(std::ifstream& file)
+#include <boost/endian/conversion.hpp>
+#include <limits>
+#include <stdexcept>
+
+
+///\cond IMPLEMENTATION_DETAILS
+//The GUIDs identifying the chunks of a Wave64 file
+constexpr uint8_t Wave64RiffGuid[16] = { 0x72, 0x69, 0x66, 0x66, 0x2E, 0x91, 0xCF, 0x11, 0xA5, 0xD6, 0x28, 0xDB, 0x04, 0xC1, 0x00, 0x00 };
+constexpr uint8_t Wave64WaveGuid[16] = { 0x77, 0x61, 0x76, 0x65, 0xF3, 0xAC, 0xD3, 0x11, 0x8C, 0xD1, 0x00, 0xC0, 0x4F, 0x8E, 0xDB, 0x8A };
+constexpr uint8_t Wave64FmtGuid[16]  = { 0x66, 0x6D, 0x74, 0x20, 0xF3, 0xAC, 0xD3, 0x11, 0x8C, 0xD1, 0x00, 0xC0, 0x4F, 0x8E, 0xDB, 0x8A };
+constexpr uint8_t Wave64DataGuid[16] = { 0x64, 0x61, 0x74, 0x61, 0xF3, 0xAC, 0xD3, 0x11, 0x8C, 0xD1, 0x00, 0xC0, 0x4F, 0x8E, 0xDB, 0x8A };
+
+//The headers of RIFF and RF64 files have the same size, so a file can be turned into a RF64 file when it is closed
+constexpr uint64_t RiffDataOffset = 80;
+constexpr uint64_t Wave64DataOffset = 104;
+//The ds64 chunk of a RF64 file without a table of chunk sizes
+constexpr uint32_t Ds64Size = 28;
+
+//Copy the next bytes of a file and tell if there were enough
+inline bool ReadExactly(InputFile& file, void* out, size_t size)
 {
-	//Read all values
-	file.read(reinterpret_cast<char*>(this), sizeof(*this));
-
-	//Correct Endianness if needed
-	if (_RIFF == 0x52494646)	//Endianness is wrong
-		toggleEndianness();
-
-	//Throw away the padding bytes between the header and data chunk
-	file.ignore(FormatDataLength - 0x10);
+	size_t count = size;
+	const uint8_t* bytes = file.Read(count);
+	memcpy(out, bytes, count);
+	return count == size;
 }
 
-
-void RIFFWaveStream::FMTHeader::save(std::ofstream& file)
+template<typename T>
+inline bool ReadLittleEndian(InputFile& file, T& value)
 {
-	//Correct for the endianness of the system
-	FMTHeader to_write = *this;
-	if (boost::endian::order::native != boost::endian::order::little)
-		to_write.toggleEndianness();
+	const bool complete = ReadExactly(file, &value, sizeof(value));
+	boost::endian::little_to_native_inplace(value);
+	return complete;
+}
 
-	//Write the Header to file
-	file.write(reinterpret_cast<char*>(&to_write), sizeof(to_write));
+template<typename T>
+inline T ReadLittleEndian(InputFile& file)
+{
+	T value = 0;
+	ReadLittleEndian(file, value);
+	return value;
 }
 
+template<typename T>
+inline void AppendLittleEndian(std::vector<uint8_t>& bytes, T value)
+{
+	boost::endian::native_to_little_inplace(value);
+	const uint8_t* first = reinterpret_cast<const uint8_t*>(&value);
+	bytes.insert(bytes.end(), first, first + sizeof(value));
+}
 
-void RIFFWaveStream::FMTHeader::toggleEndianness()
+inline void AppendId(std::vector<uint8_t>& bytes, const void* id, size_t size)
 {
-	boost::endian::endian_reverse_inplace(_RIFF);
-	boost::endian::endian_reverse_inplace(FileSize);
-	boost::endian::endian_reverse_inplace(_WAVE);
-	boost::endian::endian_reverse_inplace(FormatDataLength);
-	boost::endian::endian_reverse_inplace(FormatType);
-	boost::endian::endian_reverse_inplace(ChannelCount);
-	boost::endian::endian_reverse_inplace(FrameRate);
-	boost::endian::endian_reverse_inplace(ByteRate);
-	boost::endian::endian_reverse_inplace(BytesPerFrame);
-	boost::endian::endian_reverse_inplace(BitsPerSample);
+	const uint8_t* first = reinterpret_cast<const uint8_t*>(id);
+	bytes.insert(bytes.end(), first, first + size);
 }
+///\endcond
 
 
 
-//---------- RIFFWaveStream::DataHeader Implementation ----------//
+//---------- RIFFWaveStream::FMTHeader Implementation ----------//
 
-void RIFFWaveStream::DataHeader::load(std::ifstream& file)
+uint16_t RIFFWaveStream::FMTHeader::load(InputFile& file, uint64_t size)
 {
 	//Read all values
-	file.read(reinterpret_cast<char*>(this), sizeof(*this));
+	ReadExactly(file, this, sizeof(*this));
 
 	//Correct Endianness if needed
-	if (_data == 0x64617461)
+	const bool toggle = boost::endian::order::native != boost::endian::order::little;
+	if (toggle)
 		toggleEndianness();
+
+	uint16_t format = FormatType;
+	uint64_t extension_length = size - std::min<uint64_t>(size, sizeof(*this));
+	if (FormatType == RIFF_WAVE_EXTENSIBLE && extension_length >= 10) {
+		//The extension starts with its size, the valid bits per sample and the channel mask, followed by the GUID of the sub format
+		uint8_t extension[10];
+		ReadExactly(file, extension, sizeof(extension));
+		memcpy(&format, extension + 8, sizeof(format));
+		if (toggle)
+			boost::endian::endian_reverse_inplace(format);
+		extension_length -= sizeof(extension);
+	}
+
+	//Throw away the rest of the chunk
+	file.Seek(file.Position() + extension_length);
+	return format;
 }
 
 
-void RIFFWaveStream::DataHeader::save(std::ofstream& file)
+void RIFFWaveStream::FMTHeader::save(std::vector<uint8_t>& header) const
 {
 	//Correct for the endianness of the system
-	DataHeader to_write = *this;
+	FMTHeader to_write = *this;
 	if (boost::endian::order::native != boost::endian::order::little)
 		to_write.toggleEndianness();
 
-	//Write the Header to file
-	file.write(reinterpret_cast<char*>(&to_write), sizeof(to_write));
+	AppendId(header, &to_write, sizeof(to_write));
 }
 
 
-void RIFFWaveStream::DataHeader::toggleEndianness()
+void RIFFWaveStream::FMTHeader::toggleEndianness()
 {
-	boost::endian::endian_reverse_inplace(_data);
-	boost::endian::endian_reverse_inplace(DataSize);
+	boost::endian::endian_reverse_inplace(FormatType);
+	boost::endian::endian_reverse_inplace(ChannelCount);
+	boost::endian::endian_reverse_inplace(FrameRate);
+	boost::endian::endian_reverse_inplace(ByteRate);
+	boost::endian::endian_reverse_inplace(BytesPerFrame);
+	boost::endian::endian_reverse_inplace(BitsPerSample);
 }
 
 
@@ -89,39 +122,55 @@ RIFFWaveStream::RIFFWaveStream()
 
 //---------- RIFFWaveOStream Implementation ----------//
 
-RIFFWaveOStream::RIFFWaveOStream(const std::string& path, uint16_t channel_count) : file(path, std::ios::out | std::ios::binary)
+RIFFWaveOStream::RIFFWaveOStream(const std::string& path, uint16_t channel_count, FileWriteMode mode) : file(path, mode)
 {
 	fmt_header.ChannelCount = channel_count;
+	set16BitsPerSample();
 	//These headers are just placeholders for the ones of the configured file
-	fmt_header.save(file);
-	data_header.save(file);
+	writeHeaders();
 }
 
 
-RIFFWaveOStream::RIFFWaveOStream(const std::string& path, uint32_t sample_rate, uint16_t channel_count) : file(path, std::ios::out | std::ios::binary)
+RIFFWaveOStream::RIFFWaveOStream(const std::string& path, uint32_t sample_rate, uint16_t channel_count, FileWriteMode mode) : file(path, mode)
 {
 	fmt_header.FrameRate = sample_rate;
 	fmt_header.ChannelCount = channel_count;
+	set16BitsPerSample();
 	//These headers are just placeholders for the ones of the configured file
-	fmt_header.save(file);
-	data_header.save(file);
+	writeHeaders();
+}
+
+
+RIFFWaveOStream::RIFFWaveOStream(int descriptor, uint32_t sample_rate, uint16_t channel_count, FileWriteMode mode) : file(descriptor, mode)
+{
+	fmt_header.FrameRate = sample_rate;
+	fmt_header.ChannelCount = channel_count;
+	set16BitsPerSample();
+	//The headers are written in front of the first frame, when the format is final
 }
 
 
 RIFFWaveOStream::~RIFFWaveOStream()
 {
 	//Make sure everything is written to the file
-	writeHeaders();
-	file.flush();
-	file.close();
+	if (file.IsOpen())
+		close();
 }
 
 
 void RIFFWaveOStream::close()
 {
-	writeHeaders();
-	file.flush();
-	file.close();
+	if (file.Seekable()) {
+		data_size = file.Position() - DataOffset();
+		//The chunks of RIFF files are word aligned
+		if (container != RIFF_WAVE_W64 && data_size % 2 != 0)
+			*file.Append(1) = 0;
+		writeHeaders();
+	}
+	//The headers of a stream can't be updated, but a stream without frames still needs them
+	else if (file.Position() == 0)
+		writeHeaders();
+	file.Close();
 }
 
 
@@ -148,38 +197,226 @@ void RIFFWaveOStream::set16BitsPerSample()
 }
 
 
+void RIFFWaveOStream::setRf64()
+{
+	BOOST_ASSERT_MSG(file.Seekable(), "A stream to a file descriptor is always a RIFF file!");
+	container = RIFF_WAVE_RF64;
+}
+
+
+void RIFFWaveOStream::setWave64()
+{
+	BOOST_ASSERT_MSG(file.Seekable(), "A stream to a file descriptor is always a RIFF file!");
+	BOOST_ASSERT_MSG(file.Position() == DataOffset(), "The container has to be chosen before the first frame is written!");
+	container = RIFF_WAVE_W64;
+	//The longer headers move the start of the data
+	writeHeaders();
+}
+
+
+uint64_t RIFFWaveOStream::DataOffset() const
+{
+	return container == RIFF_WAVE_W64 ? Wave64DataOffset : RiffDataOffset;
+}
+
+
 void RIFFWaveOStream::writeHeaders()
 {
-	fmt_header.FileSize = (uint32_t)file.tellp() - 8;
-	data_header.DataSize = (uint32_t)file.tellp() - sizeof(fmt_header) - sizeof(data_header);
-	file.seekp(0);
-	fmt_header.save(file);
-	data_header.save(file);
+	std::vector<uint8_t> header;
+	header.reserve(Wave64DataOffset);
+	if (container == RIFF_WAVE_W64) {
+		//The sizes of Wave64 chunks include their 24 byte headers
+		file_size = Wave64DataOffset + data_size;
+		AppendId(header, Wave64RiffGuid, sizeof(Wave64RiffGuid));
+		AppendLittleEndian<uint64_t>(header, file_size);
+		AppendId(header, Wave64WaveGuid, sizeof(Wave64WaveGuid));
+		AppendId(header, Wave64FmtGuid, sizeof(Wave64FmtGuid));
+		AppendLittleEndian<uint64_t>(header, 24 + sizeof(fmt_header));
+		fmt_header.save(header);
+		AppendId(header, Wave64DataGuid, sizeof(Wave64DataGuid));
+		AppendLittleEndian<uint64_t>(header, 24 + data_size);
+	}
+	else {
+		//The length of a stream to a file descriptor is unknown. Readers take its data up to the end.
+		const bool streaming = !file.Seekable();
+		file_size = RiffDataOffset + data_size + data_size % 2;
+		//Switch to RF64 as soon as the sizes don't fit into 32 bits. 0xFFFFFFFF marks a size stored in the ds64 chunk.
+		if (file_size - 8 >= 0xFFFFFFFF && !streaming)
+			container = RIFF_WAVE_RF64;
+		const bool rf64 = container == RIFF_WAVE_RF64;
+		AppendId(header, rf64 ? "RF64" : "RIFF", 4);
+		AppendLittleEndian<uint32_t>(header, rf64 || streaming ? 0xFFFFFFFF : static_cast<uint32_t>(file_size - 8));
+		AppendId(header, "WAVE", 4);
+		//RIFF files reserve the space of the ds64 chunk with a JUNK chunk, which all readers skip
+		AppendId(header, rf64 ? "ds64" : "JUNK", 4);
+		AppendLittleEndian<uint32_t>(header, Ds64Size);
+		AppendLittleEndian<uint64_t>(header, rf64 ? file_size - 8 : 0);
+		AppendLittleEndian<uint64_t>(header, rf64 ? data_size : 0);
+		AppendLittleEndian<uint64_t>(header, rf64 ? FrameCount() : 0);
+		AppendLittleEndian<uint32_t>(header, 0);
+		AppendId(header, "fmt ", 4);
+		AppendLittleEndian<uint32_t>(header, sizeof(fmt_header));
+		fmt_header.save(header);
+		AppendId(header, "data", 4);
+		AppendLittleEndian<uint32_t>(header, rf64 || streaming ? 0xFFFFFFFF : static_cast<uint32_t>(data_size));
+	}
+	if (file.Seekable())
+		file.WriteAt(0, header.data(), header.size());
+	else
+		file.Write(header.data(), header.size());
 }
 
 
 
 //---------- RIFFWaveIStream Implementation ----------//
 
-RIFFWaveIStream::RIFFWaveIStream(const std::string& path) : file(path, std::ios::in | std::ios::binary)
+RIFFWaveIStream::RIFFWaveIStream(const std::string& path, FileReadMode mode)
+{
+	//The headers are parsed with a stream of their own, the samples are read through an InputFile of just the data chunk
+	InputFile file(path, 0, std::numeric_limits<uint64_t>::max());
+	const uint64_t data_offset = readHeaders(file);
+	data.reset(new InputFile(path, data_offset, data_size, mode));
+	//Don't read past the end of a truncated recording
+	data_size = data->Length();
+}
+
+
+RIFFWaveIStream::RIFFWaveIStream(int descriptor, FileReadMode mode) :
+	data(new InputFile(descriptor, mode))
+{
+	//A file descriptor can't be read twice, so the samples follow the headers in the same InputFile
+	data_start = readHeaders(*data);
+}
+
+
+uint64_t RIFFWaveIStream::readHeaders(InputFile& file)
 {
-	fmt_header.load(file);
-	data_header.load(file);
+	uint8_t id[16] = {};
+	ReadExactly(file, id, 4);
+	if (memcmp(id, "RIFF", 4) == 0 || memcmp(id, "RF64", 4) == 0)
+		return readRiffHeaders(file, memcmp(id, "RF64", 4) == 0);
+	ReadExactly(file, id + 4, 12);
+	if (memcmp(id, Wave64RiffGuid, sizeof(Wave64RiffGuid)) != 0)
+		throw std::invalid_argument("The file is neither a RIFF, RF64 nor Wave64 file!");
+	return readWave64Headers(file);
+}
+
+
+uint64_t RIFFWaveIStream::readRiffHeaders(InputFile& file, bool rf64)
+{
+	container = rf64 ? RIFF_WAVE_RF64 : RIFF_WAVE_RIFF;
+	file_size = ReadLittleEndian<uint32_t>(file) + uint64_t(8);
+	char id[4];
+	ReadExactly(file, id, sizeof(id));
+	if (memcmp(id, "WAVE", 4) != 0)
+		throw std::invalid_argument("The RIFF file doesn't contain WAVE data!");
+
+	//Walk through all chunks, the format and data chunk can be anywhere between the others
+	uint64_t position = 12;
+	uint64_t ds64_data_size = 0;
+	uint64_t data_offset = 0;
+	bool has_format = false;
+	bool has_data = false;
+	uint32_t chunk_size = 0;
+	while (ReadExactly(file, id, sizeof(id)) && ReadLittleEndian(file, chunk_size)) {
+		uint64_t size = chunk_size;
+		position += 8;
+		if (memcmp(id, "ds64", 4) == 0) {
+			//The 64 bit sizes of the RIFF and data chunk, followed by the frame count and a table of other chunk sizes
+			file_size = ReadLittleEndian<uint64_t>(file) + 8;
+			ds64_data_size = ReadLittleEndian<uint64_t>(file);
+		}
+		else if (memcmp(id, "fmt ", 4) == 0) {
+			sample_format = fmt_header.load(file, size);
+			has_format = true;
+		}
+		else if (memcmp(id, "data", 4) == 0 && !has_data) {
+			if (rf64 && size == 0xFFFFFFFF)
+				size = ds64_data_size;
+			data_size = size;
+			data_offset = position;
+			has_data = true;
+			//Writers which can't seek back don't know the size of the data, which then lasts until the end of the file
+			if (!rf64 && size == 0xFFFFFFFF) {
+				data_size = std::numeric_limits<uint64_t>::max();
+				chunks.push_back({ std::string(id, sizeof(id)), position, data_size });
+				break;
+			}
+		}
+		chunks.push_back({ std::string(id, sizeof(id)), position, size });
+		//The samples of a file descriptor follow right away
+		if (has_data && !file.Seekable())
+			break;
+		//Chunks are word aligned
+		position += size + size % 2;
+		file.Seek(position);
+	}
+	if (!has_format)
+		throw std::invalid_argument("The WAVE file has no format chunk!");
+	if (!has_data)
+		throw std::invalid_argument("The WAVE file has no data chunk!");
+	return data_offset;
+}
+
+
+uint64_t RIFFWaveIStream::readWave64Headers(InputFile& file)
+{
+	container = RIFF_WAVE_W64;
+	file_size = ReadLittleEndian<uint64_t>(file);
+	uint8_t guid[16];
+	ReadExactly(file, guid, sizeof(guid));
+	if (memcmp(guid, Wave64WaveGuid, sizeof(guid)) != 0)
+		throw std::invalid_argument("The Wave64 file doesn't contain WAVE data!");
+
+	uint64_t position = 40;
+	uint64_t data_offset = 0;
+	bool has_format = false;
+	bool has_data = false;
+	uint64_t size = 0;
+	//The sizes include the 24 byte chunk headers
+	while (ReadExactly(file, guid, sizeof(guid)) && ReadLittleEndian(file, size) && size >= 24) {
+		position += 24;
+		if (memcmp(guid, Wave64FmtGuid, sizeof(guid)) == 0) {
+			sample_format = fmt_header.load(file, size - 24);
+			has_format = true;
+		}
+		else if (memcmp(guid, Wave64DataGuid, sizeof(guid)) == 0 && !has_data) {
+			data_size = size - 24;
+			data_offset = position;
+			has_data = true;
+		}
+		chunks.push_back({ std::string(reinterpret_cast<const char*>(guid), 4), position, size - 24 });
+		if (has_data && !file.Seekable())
+			break;
+		//Chunks are aligned to 8 bytes
+		position += size - 24 + (8 - size % 8) % 8;
+		file.Seek(position);
+	}
+	if (!has_format)
+		throw std::invalid_argument("The Wave64 file has no format chunk!");
+	if (!has_data)
+		throw std::invalid_argument("The Wave64 file has no data chunk!");
+	return data_offset;
 }
 
 
-RIFFWaveIStream::~RIFFWaveIStream()
+void RIFFWaveIStream::seekFrame(uint64_t frame)
 {
-	file.close();
+	index = std::min(frame, FrameCount());
+	if (!file_buffered)
+		data->Seek(data_start + index * BytesPerFrame());
 }
 
 
 void RIFFWaveIStream::bufferAll()
 {
 	if (!file_buffered) {
-		file_buffer.resize(ChannelCount() * FrameCount());
-		for (uint32_t sample = 0; sample < file_buffer.size(); sample += ChannelCount())
-			this->operator >> (file_buffer.data() + sample);
+		BOOST_ASSERT_MSG(data_size != std::numeric_limits<uint64_t>::max(), "A stream of unknown length can't be buffered!");
+		file_buffer.resize(static_cast<size_t>(FrameCount()) * BytesPerFrame());
+		data->Seek(data_start);
+		size_t size = file_buffer.size();
+		const uint8_t* bytes = data->Read(size);
+		std::copy(bytes, bytes + size, file_buffer.begin());
 	}
 	file_buffered = true;
 	index = 0;
@@ -0,0 +1,177 @@
+#include <io/sample_conversion.h>
+#include <boost/simd/function/load.hpp>
+#include <boost/simd/function/aligned_load.hpp>
+#include <boost/simd/function/store.hpp>
+#include <boost/simd/function/pack_cast.hpp>
+#include <boost/simd/function/deinterleave_first.hpp>
+#include <boost/simd/function/deinterleave_second.hpp>
+#include <boost/simd/function/interleave_first.hpp>
+#include <boost/simd/function/interleave_second.hpp>
+#include <boost/simd/function/round.hpp>
+#include <boost/simd/function/min.hpp>
+#include <boost/simd/function/max.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+
+//Force the compiler to generate the conversions of all supported sample types
+template void DeinterleaveSamples<uint8_t>(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out);
+template void DeinterleaveSamples<int8_t>(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out);
+template void DeinterleaveSamples<int16_t>(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out);
+template void DeinterleaveSamples<int32_t>(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out);
+template void DeinterleaveSamples<float>(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out);
+template void DeinterleaveSamples<double>(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out);
+template void InterleaveSamples<uint8_t>(const Real* const* in, size_t count, uint16_t channel_count, Real scale, uint8_t* bytes);
+template void InterleaveSamples<int8_t>(const Real* const* in, size_t count, uint16_t channel_count, Real scale, uint8_t* bytes);
+template void InterleaveSamples<int16_t>(const Real* const* in, size_t count, uint16_t channel_count, Real scale, uint8_t* bytes);
+template void InterleaveSamples<float>(const Real* const* in, size_t count, uint16_t channel_count, Real scale, uint8_t* bytes);
+template void InterleaveSamples<double>(const Real* const* in, size_t count, uint16_t channel_count, Real scale, uint8_t* bytes);
+
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Unsigned samples are offset binary, so the middle of their range is the zero of the signal
+template<typename Tsample>
+constexpr Real SampleOffset()
+{
+	return std::is_unsigned<Tsample>::value ? Real(std::numeric_limits<Tsample>::max()) / 2 : Real(0);
+}
+
+//The bytes of a file or a mapping aren't aligned to the sample type, so single samples are copied instead of dereferenced
+template<typename Tsample>
+inline Tsample ReadSample(const uint8_t* bytes, size_t index)
+{
+	Tsample sample;
+	memcpy(&sample, bytes + index * sizeof(Tsample), sizeof(Tsample));
+	return sample;
+}
+
+template<typename Tsample>
+inline void WriteSample(uint8_t* bytes, size_t index, Tsample sample)
+{
+	memcpy(bytes + index * sizeof(Tsample), &sample, sizeof(Tsample));
+}
+///\endcond
+
+
+
+template<typename Tsample>
+void DeinterleaveSamples(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out)
+{
+	//One sample of the file per element of a RealSimd, so the conversion doesn't change the number of elements
+	using SampleSimd = boost::simd::pack<Tsample, RealSimd::static_size>;
+	const Tsample* samples = reinterpret_cast<const Tsample*>(bytes);
+	const RealSimd factor(scale);
+	const RealSimd offset(SampleOffset<Tsample>());
+	size_t i = 0;
+	if (std::is_same<Tsample, Real>::value && scale == 1 && channel_count == 1) {
+		memcpy(out[0], bytes, count * sizeof(Real));
+		return;
+	}
+	if (channel_count == 1) {
+		for (; i + RealSimd::static_size <= count; i += RealSimd::static_size) {
+			const SampleSimd x = boost::simd::load<SampleSimd>(samples + i);
+			boost::simd::store((boost::simd::pack_cast<Real>(x) - offset) * factor, out[0] + i);
+		}
+	}
+	else if (channel_count == 2) {
+		for (; i + RealSimd::static_size <= count; i += RealSimd::static_size) {
+			const SampleSimd a = boost::simd::load<SampleSimd>(samples + 2 * i);
+			const SampleSimd b = boost::simd::load<SampleSimd>(samples + 2 * i + RealSimd::static_size);
+			boost::simd::store((boost::simd::pack_cast<Real>(boost::simd::deinterleave_first(a, b)) - offset) * factor, out[0] + i);
+			boost::simd::store((boost::simd::pack_cast<Real>(boost::simd::deinterleave_second(a, b)) - offset) * factor, out[1] + i);
+		}
+	}
+	//Files with more channels and the frames left over are converted frame by frame
+	for (; i < count; ++i)
+		for (uint16_t channel = 0; channel < channel_count; ++channel)
+			out[channel][i] = (ReadSample<Tsample>(bytes, i * channel_count + channel) - SampleOffset<Tsample>()) * scale;
+}
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Put the three bytes into the upper bytes of an int32_t and shift it back to extend the sign
+inline int32_t Pcm24Value(const uint8_t* bytes)
+{
+	const uint32_t value = (uint32_t(bytes[0]) << 8) | (uint32_t(bytes[1]) << 16) | (uint32_t(bytes[2]) << 24);
+	return static_cast<int32_t>(value) >> 8;
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+template<>
+void DeinterleaveSamples<Pcm24>(const uint8_t* bytes, size_t count, uint16_t channel_count, Real scale, Real* const* out)
+{
+	//There are no registers of 24 bit integers, so a register of every channel is widened to 32 bits before the conversion
+	using WideSimd = boost::simd::pack<int32_t, RealSimd::static_size>;
+	alignas(WideSimd::alignment) int32_t wide[RealSimd::static_size];
+	const RealSimd factor(scale);
+	const size_t stride = 3 * channel_count;
+	size_t i = 0;
+	for (; i + RealSimd::static_size <= count; i += RealSimd::static_size) {
+		for (uint16_t channel = 0; channel < channel_count; ++channel) {
+			const uint8_t* sample = bytes + i * stride + 3 * channel;
+			for (size_t k = 0; k < RealSimd::static_size; ++k)
+				wide[k] = Pcm24Value(sample + k * stride);
+			boost::simd::store(boost::simd::pack_cast<Real>(boost::simd::aligned_load<WideSimd>(wide)) * factor, out[channel] + i);
+		}
+	}
+	for (; i < count; ++i)
+		for (uint16_t channel = 0; channel < channel_count; ++channel)
+			out[channel][i] = Pcm24Value(bytes + i * stride + 3 * channel) * scale;
+}
+///\endcond
+
+
+///\cond IMPLEMENTATION_DETAILS
+//Scale, round and saturate a register of samples, so the conversion to Tsample can't overflow. Floating point samples are only scaled.
+template<typename Tsample>
+inline boost::simd::pack<Tsample, RealSimd::static_size> Quantise(const Real* in, const RealSimd& factor)
+{
+	if (std::is_floating_point<Tsample>::value)
+		return boost::simd::pack_cast<Tsample>(boost::simd::load<RealSimd>(in) * factor);
+	const RealSimd lowest(std::numeric_limits<Tsample>::lowest());
+	const RealSimd highest(std::numeric_limits<Tsample>::max());
+	const RealSimd x = boost::simd::round(boost::simd::load<RealSimd>(in) * factor + RealSimd(SampleOffset<Tsample>()));
+	return boost::simd::pack_cast<Tsample>(boost::simd::min(boost::simd::max(x, lowest), highest));
+}
+
+template<typename Tsample>
+inline Tsample Quantise(Real in, Real scale)
+{
+	if (std::is_floating_point<Tsample>::value)
+		return static_cast<Tsample>(in * scale);
+	const Real x = std::round(in * scale + SampleOffset<Tsample>());
+	return static_cast<Tsample>(std::min(std::max(x, Real(std::numeric_limits<Tsample>::lowest())), Real(std::numeric_limits<Tsample>::max())));
+}
+///\endcond
+
+
+template<typename Tsample>
+void InterleaveSamples(const Real* const* in, size_t count, uint16_t channel_count, Real scale, uint8_t* bytes)
+{
+	using SampleSimd = boost::simd::pack<Tsample, RealSimd::static_size>;
+	Tsample* samples = reinterpret_cast<Tsample*>(bytes);
+	const RealSimd factor(scale);
+	size_t i = 0;
+	if (channel_count == 1) {
+		for (; i + RealSimd::static_size <= count; i += RealSimd::static_size)
+			boost::simd::store(Quantise<Tsample>(in[0] + i, factor), samples + i);
+	}
+	else if (channel_count == 2) {
+		for (; i + RealSimd::static_size <= count; i += RealSimd::static_size) {
+			const SampleSimd a = Quantise<Tsample>(in[0] + i, factor);
+			const SampleSimd b = Quantise<Tsample>(in[1] + i, factor);
+			boost::simd::store(boost::simd::interleave_first(a, b), samples + 2 * i);
+			boost::simd::store(boost::simd::interleave_second(a, b), samples + 2 * i + RealSimd::static_size);
+		}
+	}
+	//Files with more channels and the frames left over are converted frame by frame
+	for (; i < count; ++i)
+		for (uint16_t channel = 0; channel < channel_count; ++channel)
+			WriteSample(bytes, i * channel_count + channel, Quantise<Tsample>(in[channel][i], scale));
+}
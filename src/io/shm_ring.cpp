@@ -0,0 +1,137 @@
+#include <io/shm_ring.h>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/sync/interprocess_semaphore.hpp>
+#include <boost/assert.hpp>
+#include <atomic>
+
+
+
+constexpr size_t ShmRing::Alignment;
+
+
+///\cond IMPLEMENTATION_DETAILS
+//The state of a ring, placed in the shared memory by the side opening it first
+struct ShmRingHeader {
+	ShmRingHeader(uint64_t block_size, uint64_t block_count) :
+		block_size(block_size),
+		block_count(block_count),
+		empty_blocks(static_cast<unsigned int>(block_count)),
+		full_blocks(0)
+	{
+	}
+
+	const uint64_t block_size;
+	const uint64_t block_count;
+	//Each index is only incremented by one side, the semaphores make the blocks visible to the other
+	std::atomic<uint64_t> write_index{ 0 };
+	std::atomic<uint64_t> read_index{ 0 };
+	std::atomic<bool> reader_closed{ false };
+	std::atomic<uint32_t> users{ 0 };
+	boost::interprocess::interprocess_semaphore empty_blocks;
+	boost::interprocess::interprocess_semaphore full_blocks;
+};
+
+//The blocks, their sizes and the header, plus room for the bookkeeping of the segment
+inline size_t ShmRingSegmentSize(size_t block_size, size_t block_count)
+{
+	return block_count * (block_size + sizeof(uint64_t)) + ShmRing::Alignment + sizeof(ShmRingHeader) + 65536;
+}
+///\endcond
+
+
+ShmRing::ShmRing(const std::string& name, size_t block_size, size_t block_count, ShmRingSide side) :
+	name(name),
+	side(side),
+	segment(boost::interprocess::open_or_create, name.c_str(), ShmRingSegmentSize(block_size, block_count))
+{
+	BOOST_ASSERT_MSG(block_size % Alignment == 0, "The size of the blocks has to be a multiple of the alignment!");
+	BOOST_ASSERT_MSG(block_count > 0, "A ring needs at least one block!");
+	//Every object is constructed atomically, so it doesn't matter which side comes first
+	header = segment.find_or_construct<ShmRingHeader>("header")(block_size, block_count);
+	BOOST_ASSERT_MSG(header->block_size == block_size && header->block_count == block_count, "Both sides of a ring have to use the same geometry!");
+	sizes = segment.find_or_construct<uint64_t>("sizes")[block_count](0);
+	//The segment is mapped at page boundaries, so both sides skip the same number of bytes
+	uint8_t* memory = segment.find_or_construct<uint8_t>("blocks")[block_count * block_size + Alignment](0);
+	blocks = memory + (Alignment - reinterpret_cast<uintptr_t>(memory) % Alignment) % Alignment;
+	++header->users;
+}
+
+
+ShmRing::~ShmRing()
+{
+	Close();
+}
+
+
+uint8_t* ShmRing::PopEmpty()
+{
+	BOOST_ASSERT_MSG(side == SHM_RING_WRITER, "Only the writer can fill blocks!");
+	if (header->reader_closed)
+		return nullptr;
+	header->empty_blocks.wait();
+	//Closing the reader wakes up the writer
+	if (header->reader_closed)
+		return nullptr;
+	return blocks + header->write_index.load(std::memory_order_relaxed) % header->block_count * header->block_size;
+}
+
+
+void ShmRing::PushFull(size_t size)
+{
+	BOOST_ASSERT_MSG(size <= header->block_size, "A block can't contain more than its size!");
+	const uint64_t index = header->write_index.load(std::memory_order_relaxed);
+	sizes[index % header->block_count] = size;
+	header->write_index.store(index + 1, std::memory_order_release);
+	header->full_blocks.post();
+}
+
+
+const uint8_t* ShmRing::PopFull(size_t& size)
+{
+	BOOST_ASSERT_MSG(side == SHM_RING_READER, "Only the reader can drain blocks!");
+	header->full_blocks.wait();
+	const uint64_t index = header->read_index.load(std::memory_order_relaxed);
+	//Closing the writer posts one more time than there are blocks, which is passed on to every later call
+	if (index == header->write_index.load(std::memory_order_acquire)) {
+		header->full_blocks.post();
+		size = 0;
+		return nullptr;
+	}
+	size = static_cast<size_t>(sizes[index % header->block_count]);
+	return blocks + index % header->block_count * header->block_size;
+}
+
+
+void ShmRing::PushEmpty()
+{
+	header->read_index.store(header->read_index.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	header->empty_blocks.post();
+}
+
+
+void ShmRing::Close()
+{
+	if (!open)
+		return;
+	open = false;
+	if (side == SHM_RING_WRITER)
+		header->full_blocks.post();
+	else {
+		header->reader_closed = true;
+		header->empty_blocks.post();
+	}
+	if (--header->users == 0)
+		Remove(name);
+}
+
+
+size_t ShmRing::BlockSize() const
+{
+	return static_cast<size_t>(header->block_size);
+}
+
+
+void ShmRing::Remove(const std::string& name)
+{
+	boost::interprocess::shared_memory_object::remove(name.c_str());
+}
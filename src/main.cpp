@@ -5,8 +5,10 @@
 #include <chrono>
 #include <cstdint>
 #include <test/test.h>
+#include <stdexcept>
 #include <string>
 #include <filter/window_functions.h>
+#include <apt/apt_decoder.h>
 
 
 
@@ -19,6 +21,22 @@ int main(int argc, char* argv[])
 	if (argc >= 2 && (argv[1] == std::string("-t") || argv[1] == std::string("--test"))) {	//Run tests
 		TestAll();
 	}
+	else if (argc >= 4 && (argv[1] == std::string("-a") || argv[1] == std::string("--apt"))) {	//Decode an APT image
+		const AptSource source = argc >= 5 && argv[4] == std::string("--iq") ? APT_IQ : APT_AUDIO;
+		try {
+			auto start = std::chrono::steady_clock::now();
+			std::unique_ptr<AptDecoder> decoder = DecodeAptWave(argv[2], source);
+			auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+			decoder->WritePgm(argv[3]);
+			RIFFWaveIStream wave(argv[2]);
+			const double seconds = (double)wave.FrameCount() / wave.FrameRate();
+			std::cout << "Decoded " << decoder->LineCount() << " lines in " << duration << "ns => " << (duration * 1e-9 / seconds) << " times real time" << std::endl;
+		}
+		catch (const std::exception& e) {
+			std::cerr << e.what() << std::endl;
+			return 1;
+		}
+	}
 	else {	//Run the main program
 		constexpr uint32_t sample_rate = 44100;
 		constexpr Real seconds = 300;
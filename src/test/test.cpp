@@ -1,11 +1,28 @@
 #include <test/test.h>
 #include <iostream>
 #include <test/test_vector_io.h>
+#include <test/test_riff_wave_io.h>
+#include <test/test_raw_iq_io.h>
+#include <test/test_pipe_io.h>
+#include <test/test_shm_ring_io.h>
+#include <test/test_external_buffer_io.h>
 #include <test/test_frequency_generator.h>
 #include <test/test_frequency_shift.h>
 #include <test/test_amplitude_modulator.h>
 #include <test/test_frequency_modulator.h>
 #include <test/test_fir.h>
+#include <test/test_low_pass.h>
+#include <test/test_biquad_cascade.h>
+#include <test/test_fm_demodulator.h>
+#include <test/test_analytic_signal.h>
+#include <test/test_envelope_detector.h>
+#include <test/test_decimator.h>
+#include <test/test_correlator.h>
+#include <test/test_stft.h>
+#include <test/test_welch_psd.h>
+#include <test/test_goertzel_bank.h>
+#include <test/test_batch_filters.h>
+#include <test/test_apt_decoder.h>
 
 
 
@@ -26,6 +43,96 @@ bool TestAll()
 	}
 	else
 		std::cout << "SUCCESS : VectorInput<Complex> and VectorOutput<Complex>" << std::endl;
+	if (!TestVectorOutputStorage()) {
+		succeeded = false;
+		std::cout << "FAIL    : VectorOutput<Complex> (chunks and limit)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : VectorOutput<Complex> (chunks and limit)" << std::endl;
+	if (!TestVectorInputWrap()) {
+		succeeded = false;
+		std::cout << "FAIL    : VectorInput (wrap around)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : VectorInput (wrap around)" << std::endl;
+
+	//Testing RiffWaveInput
+	if (!TestRiffWaveInputReal()) {
+		succeeded = false;
+		std::cout << "FAIL    : RiffWaveInput<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : RiffWaveInput<Real>" << std::endl;
+	if (!TestRiffWaveInputComplex()) {
+		succeeded = false;
+		std::cout << "FAIL    : RiffWaveInput<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : RiffWaveInput<Complex>" << std::endl;
+	if (!TestRiffWaveInputFormats()) {
+		succeeded = false;
+		std::cout << "FAIL    : RiffWaveInput<Real> (sample formats)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : RiffWaveInput<Real> (sample formats)" << std::endl;
+	if (!TestRiffWaveContainers()) {
+		succeeded = false;
+		std::cout << "FAIL    : RIFFWaveStream (RF64 and Wave64)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : RIFFWaveStream (RF64 and Wave64)" << std::endl;
+	if (!TestRiffWaveChunks()) {
+		succeeded = false;
+		std::cout << "FAIL    : RIFFWaveIStream (chunks and seeking)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : RIFFWaveIStream (chunks and seeking)" << std::endl;
+
+	//Testing RiffWaveOutput
+	if (!TestRiffWaveOutputReal()) {
+		succeeded = false;
+		std::cout << "FAIL    : RiffWaveOutput<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : RiffWaveOutput<Real>" << std::endl;
+	if (!TestRiffWaveOutputComplex()) {
+		succeeded = false;
+		std::cout << "FAIL    : RiffWaveOutput<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : RiffWaveOutput<Complex>" << std::endl;
+
+	//Testing RawIqInput and RawIqOutput
+	if (!TestRawIqIO()) {
+		succeeded = false;
+		std::cout << "FAIL    : RawIqInput<Complex> and RawIqOutput<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : RawIqInput<Complex> and RawIqOutput<Complex>" << std::endl;
+
+	//Testing streaming through pipes
+	if (!TestPipeIO()) {
+		succeeded = false;
+		std::cout << "FAIL    : Streaming through pipes" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : Streaming through pipes" << std::endl;
+
+	//Testing ShmRingInput and ShmRingOutput
+	if (!TestShmRingIO()) {
+		succeeded = false;
+		std::cout << "FAIL    : ShmRingInput and ShmRingOutput" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : ShmRingInput and ShmRingOutput" << std::endl;
+
+	//Testing ExternalBufferInput and ExternalBufferOutput
+	if (!TestExternalBufferIO()) {
+		succeeded = false;
+		std::cout << "FAIL    : ExternalBufferInput<Complex> and ExternalBufferOutput<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : ExternalBufferInput<Complex> and ExternalBufferOutput<Complex>" << std::endl;
 
 	//Testing FrequencyGenerator
 	if (!TestFrequencyGeneratorReal()) {
@@ -40,6 +147,12 @@ bool TestAll()
 	}
 	else
 		std::cout << "SUCCESS : FrequencyGenerator<Complex>" << std::endl;
+	if (!TestFrequencyGeneratorNcoModes()) {
+		succeeded = false;
+		std::cout << "FAIL    : FrequencyGenerator<Complex> (NCO modes)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : FrequencyGenerator<Complex> (NCO modes)" << std::endl;
 
 	//Testing FrequencyShift
 	if (!TestFrequencyShiftReal()) {
@@ -82,6 +195,12 @@ bool TestAll()
 	}
 	else
 		std::cout << "SUCCESS : FrequencyModulator<Complex>" << std::endl;
+	if (!TestFrequencyModulatorCarrier()) {
+		succeeded = false;
+		std::cout << "FAIL    : FrequencyModulator<Complex> (carrier)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : FrequencyModulator<Complex> (carrier)" << std::endl;
 
 	//Testing Fir filters
 	if (!TestFirNoSimdImplReal()) {
@@ -109,5 +228,167 @@ bool TestAll()
 	else
 		std::cout << "SUCCESS : FirSimdImpl<Complex>" << std::endl;
 
+	//Testing LowPass
+	if (!TestLowPassMinimumPhase()) {
+		succeeded = false;
+		std::cout << "FAIL    : LowPass<Real> (minimum phase)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : LowPass<Real> (minimum phase)" << std::endl;
+
+	//Testing BiquadCascade
+	if (!TestBiquadCascadeReal()) {
+		succeeded = false;
+		std::cout << "FAIL    : BiquadCascade<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : BiquadCascade<Real>" << std::endl;
+	if (!TestBiquadCascadeComplex()) {
+		succeeded = false;
+		std::cout << "FAIL    : BiquadCascade<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : BiquadCascade<Complex>" << std::endl;
+	if (!TestBiquadCascadeGroupDelay()) {
+		succeeded = false;
+		std::cout << "FAIL    : BiquadCascade (band pass group delay)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : BiquadCascade (band pass group delay)" << std::endl;
+
+	//Testing FmDemodulator
+	if (!TestFmDemodulator()) {
+		succeeded = false;
+		std::cout << "FAIL    : FmDemodulator<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : FmDemodulator<Complex>" << std::endl;
+	if (!TestFastAtan2()) {
+		succeeded = false;
+		std::cout << "FAIL    : FastAtan2" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : FastAtan2" << std::endl;
+
+	//Testing AnalyticSignal
+	if (!TestAnalyticSignal()) {
+		succeeded = false;
+		std::cout << "FAIL    : AnalyticSignal<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : AnalyticSignal<Real>" << std::endl;
+
+	//Testing EnvelopeDetector
+	if (!TestEnvelopeDetectorReal()) {
+		succeeded = false;
+		std::cout << "FAIL    : EnvelopeDetector<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : EnvelopeDetector<Real>" << std::endl;
+	if (!TestEnvelopeDetectorComplex()) {
+		succeeded = false;
+		std::cout << "FAIL    : EnvelopeDetector<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : EnvelopeDetector<Complex>" << std::endl;
+
+	//Testing Decimator
+	if (!TestDecimatorReal()) {
+		succeeded = false;
+		std::cout << "FAIL    : Decimator<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : Decimator<Real>" << std::endl;
+	if (!TestDecimatorComplex()) {
+		succeeded = false;
+		std::cout << "FAIL    : Decimator<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : Decimator<Complex>" << std::endl;
+
+	//Testing Correlator
+	if (!TestCorrelatorDirect()) {
+		succeeded = false;
+		std::cout << "FAIL    : Correlator<Real> (direct)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : Correlator<Real> (direct)" << std::endl;
+	if (!TestCorrelatorFft()) {
+		succeeded = false;
+		std::cout << "FAIL    : Correlator<Real> (FFT)" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : Correlator<Real> (FFT)" << std::endl;
+
+	//Testing FftPlan and Stft
+	if (!TestFft()) {
+		succeeded = false;
+		std::cout << "FAIL    : FftPlan" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : FftPlan" << std::endl;
+	if (!TestStftReal()) {
+		succeeded = false;
+		std::cout << "FAIL    : Stft<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : Stft<Real>" << std::endl;
+	if (!TestStftComplex()) {
+		succeeded = false;
+		std::cout << "FAIL    : Stft<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : Stft<Complex>" << std::endl;
+
+	//Testing WelchPsd
+	if (!TestWelchPsdReal()) {
+		succeeded = false;
+		std::cout << "FAIL    : WelchPsd<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : WelchPsd<Real>" << std::endl;
+	if (!TestWelchPsdComplex()) {
+		succeeded = false;
+		std::cout << "FAIL    : WelchPsd<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : WelchPsd<Complex>" << std::endl;
+
+	//Testing GoertzelBank
+	if (!TestGoertzelBankReal()) {
+		succeeded = false;
+		std::cout << "FAIL    : GoertzelBank<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : GoertzelBank<Real>" << std::endl;
+	if (!TestGoertzelBankComplex()) {
+		succeeded = false;
+		std::cout << "FAIL    : GoertzelBank<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : GoertzelBank<Complex>" << std::endl;
+
+	//Testing the batched filters
+	if (!TestBatchFiltersReal()) {
+		succeeded = false;
+		std::cout << "FAIL    : BatchFilters<Real>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : BatchFilters<Real>" << std::endl;
+	if (!TestBatchFiltersComplex()) {
+		succeeded = false;
+		std::cout << "FAIL    : BatchFilters<Complex>" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : BatchFilters<Complex>" << std::endl;
+
+	//Testing AptDecoder
+	if (!TestAptDecoder()) {
+		succeeded = false;
+		std::cout << "FAIL    : AptDecoder" << std::endl;
+	}
+	else
+		std::cout << "SUCCESS : AptDecoder" << std::endl;
+
 	return succeeded;
 }
\ No newline at end of file